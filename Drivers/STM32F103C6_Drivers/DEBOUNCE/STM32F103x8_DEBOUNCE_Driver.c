@@ -0,0 +1,311 @@
+/*
+ * STM32F103x8_DEBOUNCE_Driver.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ */
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include "STM32F103x8_DEBOUNCE_Driver.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/***************** Generic Variables *******************/
+/*******************************************************/
+typedef struct{
+	GPIO_TypeDef *GPIOx;
+	uint16_t pinMask;
+	uint16_t activeLowMask;
+
+	/* Debounced level of every pin, 1 = pressed */
+	volatile uint16_t state;
+
+	/* 2-bit vertical counter: bit n of cnt1:cnt0 is the counter of pin n */
+	uint16_t cnt0;
+	uint16_t cnt1;
+
+	/* Pins that already queued their long press event in the current press */
+	uint16_t longReported;
+	uint16_t holdTicks[16];
+} Debounce_Port_t;
+
+static Debounce_Port_t Global_Debounce_Ports[DEBOUNCE_MAX_PORTS];
+static volatile uint8_t Global_Debounce_PortsCount = 0;
+
+static Debounce_Event_t Global_Debounce_Queue[DEBOUNCE_QUEUE_SIZE];
+static volatile uint8_t Global_Debounce_QueueHead = 0;	/* written by the tick only */
+static volatile uint8_t Global_Debounce_QueueTail = 0;	/* written by MCAL_Debounce_GetEvent() only */
+
+static Debounce_Config_t Global_Debounce_Config;
+static uint16_t Global_Debounce_LongPressTicks = 0;
+
+/*******************************************************/
+
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
+
+/**===============================================================================================
+ * @FName			- Debounce_SysTick_Reload
+ * @Brief 			- Programs the SysTick reload for Tick_ms at the given HCLK
+ * @Parameter [in] 	- HCLK_Freq: core clock in Hz
+ * @Return Value	- MCAL_OK, MCAL_ERROR if the period does not fit the 24-bit reload
+ * @Note			- The reload is clamped to 24 bits on error so the tick keeps running
+ */
+static MCAL_Status_t Debounce_SysTick_Reload(uint32_t HCLK_Freq){
+	uint32_t load = (HCLK_Freq / 1000) * Global_Debounce_Config.Tick_ms;
+
+	if((load == 0) || (load > 0x1000000UL)){
+		SysTick->LOAD = 0xFFFFFF;
+		SysTick->VAL = 0;
+		return MCAL_ERROR;
+	}
+
+	SysTick->LOAD = load - 1;
+	SysTick->VAL = 0;
+
+	return MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- Debounce_ClockChange
+ * @Brief 			- Keeps the tick period in ms across clock tree changes
+ * @Parameter [in] 	- pClocks: new bus frequencies
+ * @Return Value	- NONE
+ * @Note			- Registered with MCAL_RCC_Subscribe() when SysTick is the tick source
+ */
+static void Debounce_ClockChange(const RCC_Clocks_t *pClocks){
+	Debounce_SysTick_Reload(pClocks->HCLK_Freq);
+}
+
+/**===============================================================================================
+ * @FName			- Debounce_Push
+ * @Brief 			- Queues one event for every pin set in pins
+ * @Parameter [in] 	- GPIOx: port of the pins
+ * @Parameter [in] 	- pins: pins that produced the event
+ * @Parameter [in] 	- type: @ref Debounce_Event_define
+ * @Return Value	- NONE
+ * @Note			- Events are dropped while the queue is full
+ */
+static void Debounce_Push(GPIO_TypeDef *GPIOx, uint16_t pins, uint8_t type){
+	uint8_t head = Global_Debounce_QueueHead, next;
+	uint16_t pin;
+
+	while(pins){
+		pin = pins & (uint16_t)(-pins);
+		pins &= ~pin;
+
+		next = (head + 1) & (DEBOUNCE_QUEUE_SIZE - 1);
+		if(next == Global_Debounce_QueueTail)
+			break;
+
+		Global_Debounce_Queue[head].GPIOx = GPIOx;
+		Global_Debounce_Queue[head].pin = pin;
+		Global_Debounce_Queue[head].type = type;
+		head = next;
+	}
+
+	/* Publish the slots only after they are written */
+	Global_Debounce_QueueHead = head;
+}
+
+/*******************************************************/
+
+/*******************************************************/
+/***** APIs Supported by "MCAL DEBOUNCE DRIVER" ********/
+/*******************************************************/
+
+/**================================================================
+ * @Fn				- MCAL_Debounce_Init
+ * @brief 			- Sets the sampling period and starts the tick source
+ * @param [in] 		- pDebounce_Config: sampling period, long press time and tick source
+ * @retval 			- MCAL_OK, MCAL_ERROR if Tick_ms is 0 or too long for SysTick, or if SysTick is
+ * 					  requested while DEBOUNCE_USE_SYSTICK is 0
+ * Note				- Add the ports with MCAL_Debounce_AddPort(), their GPIO must already be configured as inputs
+ * 					- With @ref Debounce_TickSource_SysTick the driver owns SysTick_Handler
+ */
+MCAL_Status_t MCAL_Debounce_Init(const Debounce_Config_t *pDebounce_Config){
+	if(pDebounce_Config->Tick_ms == 0)
+		return MCAL_ERROR;
+
+	if(!DEBOUNCE_USE_SYSTICK && (pDebounce_Config->TickSource == Debounce_TickSource_SysTick))
+		return MCAL_ERROR;
+
+	Global_Debounce_Config = *pDebounce_Config;
+	Global_Debounce_LongPressTicks = (Global_Debounce_Config.LongPress_ms + Global_Debounce_Config.Tick_ms - 1) / Global_Debounce_Config.Tick_ms;
+
+	if(Global_Debounce_Config.TickSource != Debounce_TickSource_SysTick)
+		return MCAL_OK;
+
+	SysTick->CTRL = 0;
+	if(Debounce_SysTick_Reload(MCAL_RCC_GetHCLKFreq()) != MCAL_OK)
+		return MCAL_ERROR;
+
+	if(MCAL_RCC_Subscribe(Debounce_ClockChange) != MCAL_OK)
+		return MCAL_ERROR;
+
+	/* Bit 2 CLKSOURCE: HCLK, Bit 1 TICKINT, Bit 0 ENABLE */
+	SysTick->CTRL = (1 << 2) | (1 << 1) | (1 << 0);
+
+	return MCAL_OK;
+}
+
+/**================================================================
+ * @Fn				- MCAL_Debounce_DeInit
+ * @brief 			- Stops the tick, forgets the ports and empties the queue
+ * @retval 			- None
+ * Note				- None
+ */
+void MCAL_Debounce_DeInit(void){
+	/* SysTick is not touched when the application owns it */
+	if(DEBOUNCE_USE_SYSTICK && (Global_Debounce_Config.TickSource == Debounce_TickSource_SysTick)){
+		SysTick->CTRL = 0;
+		MCAL_RCC_Unsubscribe(Debounce_ClockChange);
+	}
+
+	Global_Debounce_PortsCount = 0;
+	Global_Debounce_QueueTail = Global_Debounce_QueueHead;
+}
+
+/**================================================================
+ * @Fn				- MCAL_Debounce_AddPort
+ * @brief 			- Adds pins of a port to the sampled set
+ * @param [in] 		- GPIOx: where x can be (A..E depending on device used) to select the GPIO peripheral
+ * @param [in] 		- PinMask: pins to debounce, an OR of @ref GPIO_PIN_define
+ * @param [in] 		- ActiveLowMask: pins of PinMask that read 0 when pressed (pull-up buttons)
+ * @retval 			- MCAL_OK, MCAL_ERROR if DEBOUNCE_MAX_PORTS ports are already sampled
+ * Note				- Calling it again for the same port replaces its masks
+ * 					- The current levels are taken as the starting state, no event is queued for them
+ */
+MCAL_Status_t MCAL_Debounce_AddPort(GPIO_TypeDef *GPIOx, uint16_t PinMask, uint16_t ActiveLowMask){
+	Debounce_Port_t *pPort;
+	uint8_t i;
+
+	for(i = 0; i < Global_Debounce_PortsCount; i++){
+		if(Global_Debounce_Ports[i].GPIOx == GPIOx)
+			break;
+	}
+
+	if(i == DEBOUNCE_MAX_PORTS)
+		return MCAL_ERROR;
+
+	pPort = &Global_Debounce_Ports[i];
+	pPort->GPIOx = GPIOx;
+	pPort->pinMask = PinMask;
+	pPort->activeLowMask = ActiveLowMask & PinMask;
+	pPort->state = (MCAL_GPIO_ReadPort(GPIOx) ^ pPort->activeLowMask) & PinMask;
+	pPort->cnt0 = 0;
+	pPort->cnt1 = 0;
+	pPort->longReported = pPort->state;
+
+	/* Make the port visible to the tick once it is complete */
+	if(i == Global_Debounce_PortsCount)
+		Global_Debounce_PortsCount = i + 1;
+
+	return MCAL_OK;
+}
+
+/**================================================================
+ * @Fn				- MCAL_Debounce_Tick
+ * @brief 			- Samples every added port once and queues the state changes
+ * @retval 			- None
+ * Note				- Called from SysTick_Handler, or from a timer ISR with @ref Debounce_TickSource_External
+ * 					- One IDR read per port, the 16 pins are debounced in parallel by a 2-bit vertical counter
+ */
+void MCAL_Debounce_Tick(void){
+	Debounce_Port_t *pPort;
+	uint16_t sample, delta, toggle, held, pin;
+	uint8_t i, n;
+
+	for(i = 0; i < Global_Debounce_PortsCount; i++){
+		pPort = &Global_Debounce_Ports[i];
+		sample = (MCAL_GPIO_ReadPort(pPort->GPIOx) ^ pPort->activeLowMask) & pPort->pinMask;
+
+		/* Counters run while a pin differs from its state and restart as soon as it agrees again */
+		delta = sample ^ pPort->state;
+		pPort->cnt1 = (pPort->cnt1 ^ pPort->cnt0) & delta;
+		pPort->cnt0 = ~pPort->cnt0 & delta;
+
+		/* A pin toggles on the 4th different sample in a row, its counter is then back at 0 */
+		toggle = delta & ~(pPort->cnt0 | pPort->cnt1);
+		pPort->state ^= toggle;
+
+		if(toggle){
+			Debounce_Push(pPort->GPIOx, toggle & pPort->state, Debounce_Event_Press);
+			Debounce_Push(pPort->GPIOx, toggle & ~pPort->state, Debounce_Event_Release);
+			pPort->longReported &= ~toggle;
+		}
+
+		if(Global_Debounce_LongPressTicks == 0)
+			continue;
+
+		held = pPort->state & ~pPort->longReported;
+		while(held){
+			pin = held & (uint16_t)(-held);
+			held &= ~pin;
+			n = __builtin_ctz(pin);
+
+			if(toggle & pin)
+				pPort->holdTicks[n] = 0;
+
+			if(++pPort->holdTicks[n] >= Global_Debounce_LongPressTicks){
+				pPort->longReported |= pin;
+				Debounce_Push(pPort->GPIOx, pin, Debounce_Event_LongPress);
+			}
+		}
+	}
+}
+
+/**================================================================
+ * @Fn				- MCAL_Debounce_GetEvent
+ * @brief 			- Takes the oldest queued event
+ * @param [out] 	- pEvent: filled with the event
+ * @retval 			- 1 if an event was taken, 0 if the queue is empty
+ * Note				- Single consumer, call it from the main loop only
+ */
+uint8_t MCAL_Debounce_GetEvent(Debounce_Event_t *pEvent){
+	uint8_t tail = Global_Debounce_QueueTail;
+
+	if(tail == Global_Debounce_QueueHead)
+		return 0;
+
+	*pEvent = Global_Debounce_Queue[tail];
+	Global_Debounce_QueueTail = (tail + 1) & (DEBOUNCE_QUEUE_SIZE - 1);
+
+	return 1;
+}
+
+/**================================================================
+ * @Fn				- MCAL_Debounce_GetState
+ * @brief 			- Reads the debounced level of a port
+ * @param [in] 		- GPIOx: where x can be (A..E depending on device used) to select the GPIO peripheral
+ * @retval 			- Pins currently pressed (active level already applied), 0 if the port is not added
+ * Note				- None
+ */
+uint16_t MCAL_Debounce_GetState(GPIO_TypeDef *GPIOx){
+	uint8_t i;
+
+	for(i = 0; i < Global_Debounce_PortsCount; i++){
+		if(Global_Debounce_Ports[i].GPIOx == GPIOx)
+			return Global_Debounce_Ports[i].state;
+	}
+
+	return 0;
+}
+
+/*******************************************************/
+
+/*******************************************************/
+/****************** ISR Functions **********************/
+/*******************************************************/
+#if DEBOUNCE_USE_SYSTICK
+void SysTick_Handler(void){
+	if(Global_Debounce_Config.TickSource == Debounce_TickSource_SysTick)
+		MCAL_Debounce_Tick();
+}
+#endif
+
+/*******************************************************/
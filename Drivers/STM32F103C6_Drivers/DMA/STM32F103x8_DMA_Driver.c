@@ -0,0 +1,549 @@
+/*
+ * STM32F103x8_DMA_Driver.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ */
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include "STM32F103x8_DMA_Driver.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/***************** Generic Variables *******************/
+/*******************************************************/
+/**
+ * index [0] --> DMA1_Channel1
+ * ...
+ * index [6] --> DMA1_Channel7
+ */
+static void (* GP_DMA_IRQ_CallBack[7])(struct S_DMA_IRQ_SRC irq_src) = {NULL};
+
+static DMA_Channel_TypeDef * const GP_DMA_Channel[7] = {
+		DMA1_Channel1, DMA1_Channel2, DMA1_Channel3, DMA1_Channel4,
+		DMA1_Channel5, DMA1_Channel6, DMA1_Channel7
+};
+
+/* Driver (or application object) owning each channel, NULL when free */
+static const void * volatile GP_DMA_Owner[7] = {NULL};
+
+/* Memory to memory engine, one operation at a time on a claimed spare channel */
+typedef struct{
+	DMA_Channel_TypeDef *channel;
+	uint32_t src;				/* next source address (CPAR) */
+	uint32_t dst;				/* next destination address (CMAR) */
+	uint32_t remaining;			/* items left after the running chunk */
+	uint8_t width;				/* bytes per item: 1, 2 or 4 */
+	uint8_t srcInc;				/* 0 for fill (source is the pattern) */
+	volatile uint8_t busy;
+	uint32_t pattern;			/* fill source, must live during the transfer */
+	void (* P_Done_CallBack)(MCAL_Status_t status);
+} DMA_Mem_t;
+
+static DMA_Mem_t G_DMA_Mem;
+
+/*******************************************************/
+
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
+/**===============================================================================================
+ * @FName			- DMA_Lock
+ * @Brief 			- Masks the interrupts around an ownership test-and-set
+ * @Return Value	- previous PRIMASK, to be passed to DMA_Unlock()
+ * Note				- Claims are made from thread context and from interrupts (e.g. next bus transaction)
+ */
+static inline uint32_t DMA_Lock(void){
+	uint32_t primask;
+
+	__asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+
+	return primask;
+}
+
+/**===============================================================================================
+ * @FName			- DMA_Unlock
+ * @Brief 			- Restores the PRIMASK saved by DMA_Lock()
+ * @Parameter [in] 	- primask: value returned by DMA_Lock()
+ * @Return Value	- NONE
+ * Note				- Nested locks keep the interrupts masked until the outer one ends
+ */
+static inline void DMA_Unlock(uint32_t primask){
+	__asm volatile ("msr primask, %0" :: "r" (primask) : "memory");
+}
+
+/**===============================================================================================
+ * @FName			- Enable_NVIC
+ * @Brief 			- Enables the NVIC line of the passed channel index
+ * @Parameter [in] 	- index: DMA1 channel index [0..6]
+ * @Return Value	- NONE
+ * Note				- NONE
+ */
+static void Enable_NVIC(uint8_t index){
+	switch(index){
+		case 0: NVIC_IRQ11_DMA1_CH1_ENABLE(); break;
+		case 1: NVIC_IRQ12_DMA1_CH2_ENABLE(); break;
+		case 2: NVIC_IRQ13_DMA1_CH3_ENABLE(); break;
+		case 3: NVIC_IRQ14_DMA1_CH4_ENABLE(); break;
+		case 4: NVIC_IRQ15_DMA1_CH5_ENABLE(); break;
+		case 5: NVIC_IRQ16_DMA1_CH6_ENABLE(); break;
+		case 6: NVIC_IRQ17_DMA1_CH7_ENABLE(); break;
+		default: /* Do Nothing */ break;
+	}
+}
+
+/**===============================================================================================
+ * @FName			- Disable_NVIC
+ * @Brief 			- Disables the NVIC line of the passed channel index
+ * @Parameter [in] 	- index: DMA1 channel index [0..6]
+ * @Return Value	- NONE
+ * Note				- NONE
+ */
+static void Disable_NVIC(uint8_t index){
+	switch(index){
+		case 0: NVIC_IRQ11_DMA1_CH1_DISABLE(); break;
+		case 1: NVIC_IRQ12_DMA1_CH2_DISABLE(); break;
+		case 2: NVIC_IRQ13_DMA1_CH3_DISABLE(); break;
+		case 3: NVIC_IRQ14_DMA1_CH4_DISABLE(); break;
+		case 4: NVIC_IRQ15_DMA1_CH5_DISABLE(); break;
+		case 5: NVIC_IRQ16_DMA1_CH6_DISABLE(); break;
+		case 6: NVIC_IRQ17_DMA1_CH7_DISABLE(); break;
+		default: /* Do Nothing */ break;
+	}
+}
+
+/**===============================================================================================
+ * @FName			- DMA_Mem_Next
+ * @Brief 			- Starts the next chunk (up to 65535 items) of the memory engine
+ * @Return Value	- NONE
+ * Note				- NONE
+ */
+static void DMA_Mem_Next(void){
+	uint32_t chunk = (G_DMA_Mem.remaining > 0xFFFF) ? 0xFFFF : G_DMA_Mem.remaining;
+
+	MCAL_DMA_Start(G_DMA_Mem.channel, G_DMA_Mem.src, G_DMA_Mem.dst, (uint16_t)chunk);
+
+	if(G_DMA_Mem.srcInc)
+		G_DMA_Mem.src += chunk * G_DMA_Mem.width;
+	G_DMA_Mem.dst += chunk * G_DMA_Mem.width;
+	G_DMA_Mem.remaining -= chunk;
+}
+
+/**===============================================================================================
+ * @FName			- DMA_Mem_CallBack
+ * @Brief 			- Chains the chunks and ends the memory operation
+ * @Parameter [in] 	- irq_src: DMA interrupt source
+ * @Return Value	- NONE
+ * Note				- Called from the DMA interrupt
+ */
+static void DMA_Mem_CallBack(struct S_DMA_IRQ_SRC irq_src){
+	if(!irq_src.TE && (G_DMA_Mem.remaining != 0)){
+		DMA_Mem_Next();
+		return;
+	}
+
+	MCAL_DMA_Stop(G_DMA_Mem.channel);
+	MCAL_DMA_Release(G_DMA_Mem.channel, &G_DMA_Mem);
+	G_DMA_Mem.busy = 0;
+
+	if(G_DMA_Mem.P_Done_CallBack != NULL)
+		G_DMA_Mem.P_Done_CallBack(irq_src.TE ? MCAL_ERROR : MCAL_OK);
+}
+
+/**===============================================================================================
+ * @FName			- DMA_Mem_Acquire
+ * @Brief 			- Takes the memory to memory engine and a spare channel for it
+ * @Return Value	- MCAL_OK, MCAL_BUSY (engine running or no free channel)
+ * Note				- The busy test-and-set is made with the interrupts masked, as in MCAL_DMA_Claim(),
+ * 					  a callback starting the next operation cannot slip between the test and the set
+ */
+static MCAL_Status_t DMA_Mem_Acquire(void){
+	uint32_t primask;
+
+	primask = DMA_Lock();
+	if(G_DMA_Mem.busy){
+		DMA_Unlock(primask);
+		return MCAL_BUSY;
+	}
+	G_DMA_Mem.busy = 1;
+	DMA_Unlock(primask);
+
+	G_DMA_Mem.channel = MCAL_DMA_ClaimAny(&G_DMA_Mem);
+	if(G_DMA_Mem.channel == NULL){
+		G_DMA_Mem.busy = 0;
+		return MCAL_BUSY;
+	}
+
+	return MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- DMA_Mem_Start
+ * @Brief 			- Common start of MCAL_DMA_MemCopy() / MCAL_DMA_MemSet()
+ * @Parameter [in] 	- dst, src: addresses, src is the pattern address for a fill
+ * @Parameter [in] 	- length: bytes to write
+ * @Parameter [in] 	- srcInc: 1 for copy, 0 for fill
+ * @Parameter [in] 	- P_Done_CallBack: completion function (can be NULL)
+ * @Return Value	- NONE
+ * Note				- The engine must be taken by DMA_Mem_Acquire() first
+ * 					- Widest item allowed by the alignment of dst, src and length
+ */
+static void DMA_Mem_Start(uint32_t dst, uint32_t src, uint32_t length, uint8_t srcInc, void (* P_Done_CallBack)(MCAL_Status_t status)){
+	DMA_Config_t DMA_Cfg;
+	uint32_t align = dst | length | (srcInc ? src : 0);
+
+	if((align & 0x3) == 0){
+		G_DMA_Mem.width = 4;
+		DMA_Cfg.periphSize = DMA_PeriphSize_32bits;
+		DMA_Cfg.memSize = DMA_MemSize_32bits;
+	}
+	else if((align & 0x1) == 0){
+		G_DMA_Mem.width = 2;
+		DMA_Cfg.periphSize = DMA_PeriphSize_16bits;
+		DMA_Cfg.memSize = DMA_MemSize_16bits;
+	}
+	else{
+		G_DMA_Mem.width = 1;
+		DMA_Cfg.periphSize = DMA_PeriphSize_8bits;
+		DMA_Cfg.memSize = DMA_MemSize_8bits;
+	}
+
+	G_DMA_Mem.src = src;
+	G_DMA_Mem.dst = dst;
+	G_DMA_Mem.remaining = length / G_DMA_Mem.width;
+	G_DMA_Mem.srcInc = srcInc;
+	G_DMA_Mem.P_Done_CallBack = P_Done_CallBack;
+
+	/* CPAR (source) --> CMAR (destination), lowest priority so peripheral streams are served first */
+	DMA_Cfg.direction = DMA_Direction_MemToMem;
+	DMA_Cfg.priority = DMA_Priority_Low;
+	DMA_Cfg.periphInc = srcInc ? DMA_PeriphInc_Enable : DMA_PeriphInc_Disable;
+	DMA_Cfg.memInc = DMA_MemInc_Enable;
+	DMA_Cfg.mode = DMA_Mode_Normal;
+	DMA_Cfg.IRQ_EN = DMA_IRQ_TC | DMA_IRQ_TE;
+	DMA_Cfg.P_IRQ_CallBack = DMA_Mem_CallBack;
+	MCAL_DMA_Init(G_DMA_Mem.channel, &DMA_Cfg);
+
+	DMA_Mem_Next();
+}
+
+/*******************************************************/
+
+/*******************************************************/
+/******* APIs Supported by "MCAL DMA DRIVER" ***********/
+/*******************************************************/
+
+/**================================================================
+ * @Fn				- MCAL_DMA_Init
+ * @brief 			- Configures a DMA1 channel according to DMA_Config (channel is left disabled)
+ * @param [in] 		- DMA_Channelx: where x can be (1..7) to select the DMA1 channel
+ * @param [in] 		- DMA_Config: All DMA channel configurations
+ * @retval 			- None
+ * Note				- The channel request source is fixed by hardware (see RM0008 Table 78)
+ */
+void MCAL_DMA_Init(DMA_Channel_TypeDef *DMA_Channelx, DMA_Config_t *DMA_Config){
+	uint8_t index = DMA_CHANNEL_INDEX(DMA_Channelx);
+
+	/* Enable DMA1 clock */
+	RCC_DMA1_CLK_EN();
+
+	/* CCR can only be written while the channel is disabled */
+	DMA_Channelx->CCR &= ~(DMA_CCR_EN);
+
+	DMA_Channelx->CCR = DMA_Config->direction	|
+						DMA_Config->priority	|
+						DMA_Config->periphSize	|
+						DMA_Config->memSize		|
+						DMA_Config->periphInc	|
+						DMA_Config->memInc		|
+						DMA_Config->mode		|
+						DMA_Config->IRQ_EN;
+
+	/* Clear any stale flags of this channel */
+	DMA1->IFCR = DMA_FLAG_GIF(index);
+
+	GP_DMA_IRQ_CallBack[index] = DMA_Config->P_IRQ_CallBack;
+
+	/* The NVIC line is left alone without interrupts, no source of this channel can raise it */
+	if(DMA_Config->IRQ_EN != DMA_IRQ_NONE)
+		Enable_NVIC(index);
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_DeInit
+ * @brief 			- Disables a DMA1 channel and resets its registers
+ * @param [in] 		- DMA_Channelx: where x can be (1..7) to select the DMA1 channel
+ * @retval 			- None
+ * Note				- DMA1 has no reset bit in RCC so the channel registers are cleared one by one
+ * 					- The NVIC line is only disabled if the channel had interrupts enabled
+ */
+void MCAL_DMA_DeInit(DMA_Channel_TypeDef *DMA_Channelx){
+	uint8_t index = DMA_CHANNEL_INDEX(DMA_Channelx);
+
+	if(DMA_Channelx->CCR & (DMA_IRQ_TC | DMA_IRQ_HT | DMA_IRQ_TE))
+		Disable_NVIC(index);
+
+	DMA_Channelx->CCR   = 0;
+	DMA_Channelx->CNDTR = 0;
+	DMA_Channelx->CPAR  = 0;
+	DMA_Channelx->CMAR  = 0;
+
+	DMA1->IFCR = DMA_FLAG_GIF(index);
+
+	GP_DMA_IRQ_CallBack[index] = NULL;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_Start
+ * @brief 			- Loads the addresses / count and enables the channel
+ * @param [in] 		- DMA_Channelx: where x can be (1..7) to select the DMA1 channel
+ * @param [in] 		- periphAddress: peripheral register address (e.g. &USARTx->DR), source address in DMA_Direction_MemToMem
+ * @param [in] 		- memAddress: memory buffer address (used as is, no copy), destination address in DMA_Direction_MemToMem
+ * @param [in] 		- dataLength: number of data items to transfer (1..65535)
+ * @retval 			- None
+ * Note				- MCAL_DMA_Init() must be called first
+ * 					- DMA_Direction_MemToMem starts right away and can not be circular
+ */
+void MCAL_DMA_Start(DMA_Channel_TypeDef *DMA_Channelx, uint32_t periphAddress, uint32_t memAddress, uint16_t dataLength){
+	uint8_t index = DMA_CHANNEL_INDEX(DMA_Channelx);
+
+	/* CPAR, CMAR and CNDTR are write protected while EN = 1 */
+	DMA_Channelx->CCR &= ~(DMA_CCR_EN);
+
+	DMA1->IFCR = DMA_FLAG_GIF(index);
+
+	DMA_Channelx->CPAR  = periphAddress;
+	DMA_Channelx->CMAR  = memAddress;
+	DMA_Channelx->CNDTR = dataLength;
+
+	DMA_Channelx->CCR |= DMA_CCR_EN;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_Stop
+ * @brief 			- Disables the channel (aborts an ongoing transfer)
+ * @param [in] 		- DMA_Channelx: where x can be (1..7) to select the DMA1 channel
+ * @retval 			- None
+ * Note				- None
+ */
+void MCAL_DMA_Stop(DMA_Channel_TypeDef *DMA_Channelx){
+	DMA_Channelx->CCR &= ~(DMA_CCR_EN);
+
+	DMA1->IFCR = DMA_FLAG_GIF(DMA_CHANNEL_INDEX(DMA_Channelx));
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_GetRemaining
+ * @brief 			- Number of data items still to be transferred (CNDTR)
+ * @param [in] 		- DMA_Channelx: where x can be (1..7) to select the DMA1 channel
+ * @retval 			- remaining data items
+ * Note				- In circular mode CNDTR is reloaded after reaching 0, so (length - remaining)
+ * 					  is the write position inside the buffer
+ */
+uint16_t MCAL_DMA_GetRemaining(DMA_Channel_TypeDef *DMA_Channelx){
+	return (uint16_t)DMA_Channelx->CNDTR;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_Claim
+ * @brief 			- Reserves a channel for one driver before using it
+ * @param [in] 		- DMA_Channelx: where x can be (1..7) to select the DMA1 channel (see @ref DMA_Request_define)
+ * @param [in] 		- owner: any address identifying the user (e.g. the peripheral instance), not NULL
+ * @retval 			- MCAL_OK if free or already owned by owner, MCAL_BUSY if owned by another user, MCAL_ERROR if owner is NULL
+ * Note				- Safe from thread context and interrupts, the test-and-set runs with interrupts masked
+ */
+MCAL_Status_t MCAL_DMA_Claim(DMA_Channel_TypeDef *DMA_Channelx, const void *owner){
+	uint8_t index = DMA_CHANNEL_INDEX(DMA_Channelx);
+	MCAL_Status_t status = MCAL_OK;
+	uint32_t primask;
+
+	if(owner == NULL)
+		return MCAL_ERROR;
+
+	primask = DMA_Lock();
+
+	if((GP_DMA_Owner[index] != NULL) && (GP_DMA_Owner[index] != owner))
+		status = MCAL_BUSY;
+	else
+		GP_DMA_Owner[index] = owner;
+
+	DMA_Unlock(primask);
+
+	return status;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_ClaimAny
+ * @brief 			- Reserves the first free channel (memory to memory transfers need no request line)
+ * @param [in] 		- owner: any address identifying the user, not NULL
+ * @retval 			- claimed channel, NULL if all channels are owned
+ * Note				- Channel 1 is tried first as no USART / SPI / I2C request uses it
+ * 					- The whole search runs with interrupts masked, like MCAL_DMA_Claim()
+ */
+DMA_Channel_TypeDef *MCAL_DMA_ClaimAny(const void *owner){
+	DMA_Channel_TypeDef *channel = NULL;
+	uint32_t primask;
+	uint8_t index;
+
+	if(owner == NULL)
+		return NULL;
+
+	primask = DMA_Lock();
+
+	for(index = 0; (index < 7) && (channel == NULL); index++){
+		if(GP_DMA_Owner[index] == owner)
+			channel = GP_DMA_Channel[index];
+	}
+
+	for(index = 0; (index < 7) && (channel == NULL); index++){
+		if(GP_DMA_Owner[index] == NULL){
+			GP_DMA_Owner[index] = owner;
+			channel = GP_DMA_Channel[index];
+		}
+	}
+
+	DMA_Unlock(primask);
+
+	return channel;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_Release
+ * @brief 			- Gives a channel back
+ * @param [in] 		- DMA_Channelx: where x can be (1..7) to select the DMA1 channel
+ * @param [in] 		- owner: the user which claimed it (other users can not release it)
+ * @retval 			- None
+ * Note				- Stop the channel first, the registers are left as they are
+ */
+void MCAL_DMA_Release(DMA_Channel_TypeDef *DMA_Channelx, const void *owner){
+	uint8_t index = DMA_CHANNEL_INDEX(DMA_Channelx);
+
+	if(GP_DMA_Owner[index] == owner)
+		GP_DMA_Owner[index] = NULL;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_GetOwner
+ * @brief 			- User currently owning a channel
+ * @param [in] 		- DMA_Channelx: where x can be (1..7) to select the DMA1 channel
+ * @retval 			- owner passed to MCAL_DMA_Claim(), NULL if free
+ * Note				- None
+ */
+const void *MCAL_DMA_GetOwner(DMA_Channel_TypeDef *DMA_Channelx){
+	return GP_DMA_Owner[DMA_CHANNEL_INDEX(DMA_Channelx)];
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_MemCopy
+ * @brief 			- Copies a memory block in the background (asynchronous memcpy)
+ * @param [out] 	- pDst: destination (must not overlap pSrc)
+ * @param [in] 		- pSrc: source, must stay unchanged until the callback
+ * @param [in] 		- length: number of bytes (blocks above 65535 items are chained in the DMA interrupt)
+ * @param [in] 		- P_Done_CallBack: called from the DMA interrupt with MCAL_OK or MCAL_ERROR (bus error), can be NULL
+ * @retval 			- MCAL_OK if started, MCAL_BUSY if a memory operation is running or all channels are claimed,
+ * 					  MCAL_ERROR on wrong parameters
+ * Note				- Word transfers when pDst, pSrc and length are multiples of 4 (else half-word / byte)
+ * 					- Setup costs about as much as a CPU copy of a few tens of bytes, use it for larger blocks
+ */
+MCAL_Status_t MCAL_DMA_MemCopy(void *pDst, const void *pSrc, uint32_t length, void (* P_Done_CallBack)(MCAL_Status_t status)){
+	if((pDst == NULL) || (pSrc == NULL) || (length == 0))
+		return MCAL_ERROR;
+
+	if(DMA_Mem_Acquire() != MCAL_OK)
+		return MCAL_BUSY;
+
+	DMA_Mem_Start((uint32_t)pDst, (uint32_t)pSrc, length, 1, P_Done_CallBack);
+
+	return MCAL_OK;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_MemSet
+ * @brief 			- Fills a memory block in the background (asynchronous memset)
+ * @param [out] 	- pDst: destination
+ * @param [in] 		- value: byte written to every location
+ * @param [in] 		- length: number of bytes
+ * @param [in] 		- P_Done_CallBack: called from the DMA interrupt with MCAL_OK or MCAL_ERROR (bus error), can be NULL
+ * @retval 			- MCAL_OK if started, MCAL_BUSY if a memory operation is running or all channels are claimed,
+ * 					  MCAL_ERROR on wrong parameters
+ * Note				- Word transfers when pDst and length are multiples of 4 (else half-word / byte)
+ */
+MCAL_Status_t MCAL_DMA_MemSet(void *pDst, uint8_t value, uint32_t length, void (* P_Done_CallBack)(MCAL_Status_t status)){
+	if((pDst == NULL) || (length == 0))
+		return MCAL_ERROR;
+
+	if(DMA_Mem_Acquire() != MCAL_OK)
+		return MCAL_BUSY;
+
+	/* Same byte in every lane, so any item width reads the right value */
+	G_DMA_Mem.pattern = (uint32_t)value * 0x01010101UL;
+
+	DMA_Mem_Start((uint32_t)pDst, (uint32_t)&G_DMA_Mem.pattern, length, 0, P_Done_CallBack);
+
+	return MCAL_OK;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DMA_MemIsBusy
+ * @brief 			- State of the memory to memory engine
+ * @retval 			- 1 while a MCAL_DMA_MemCopy() / MCAL_DMA_MemSet() is running, else 0
+ * Note				- None
+ */
+uint8_t MCAL_DMA_MemIsBusy(void){
+	return G_DMA_Mem.busy;
+}
+
+/*******************************************************/
+
+/*******************************************************/
+/****************** ISR Functions **********************/
+/*******************************************************/
+static void DMA_IRQ_Handler(uint8_t index){
+	struct S_DMA_IRQ_SRC irq_src;
+	uint32_t isr = DMA1->ISR;
+	uint32_t ccr = GP_DMA_Channel[index]->CCR;
+
+	/* Flags are set even if their interrupt is disabled, report the enabled ones only */
+	irq_src.TC = ((isr & DMA_FLAG_TCIF(index)) && (ccr & DMA_IRQ_TC)) ? 1 : 0;
+	irq_src.TE = ((isr & DMA_FLAG_TEIF(index)) && (ccr & DMA_IRQ_TE)) ? 1 : 0;
+	irq_src.HT = ((isr & DMA_FLAG_HTIF(index)) && (ccr & DMA_IRQ_HT)) ? 1 : 0;
+
+	/* Clear all flags of this channel (GIFx clears TCIFx, HTIFx and TEIFx) */
+	DMA1->IFCR = DMA_FLAG_GIF(index);
+
+	if(GP_DMA_IRQ_CallBack[index] != NULL)
+		GP_DMA_IRQ_CallBack[index](irq_src);
+}
+
+void DMA1_Channel1_IRQHandler(void){
+	DMA_IRQ_Handler(0);
+}
+
+void DMA1_Channel2_IRQHandler(void){
+	DMA_IRQ_Handler(1);
+}
+
+void DMA1_Channel3_IRQHandler(void){
+	DMA_IRQ_Handler(2);
+}
+
+void DMA1_Channel4_IRQHandler(void){
+	DMA_IRQ_Handler(3);
+}
+
+void DMA1_Channel5_IRQHandler(void){
+	DMA_IRQ_Handler(4);
+}
+
+void DMA1_Channel6_IRQHandler(void){
+	DMA_IRQ_Handler(5);
+}
+
+void DMA1_Channel7_IRQHandler(void){
+	DMA_IRQ_Handler(6);
+}
+
+/*******************************************************/
@@ -0,0 +1,61 @@
+/*
+ * STM32F103x8_DWT_Driver.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ */
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include "STM32F103x8_DWT_Driver.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/***************** Generic Variables *******************/
+/*******************************************************/
+/* HCLK cycles per ms, 0 until MCAL_DWT_Init() runs */
+static uint32_t Global_DWT_CyclesPerMs = 0;
+
+/*******************************************************/
+
+/*******************************************************/
+/******* APIs Supported by "MCAL DWT DRIVER" ***********/
+/*******************************************************/
+
+/**================================================================
+ * @Fn				- MCAL_DWT_Init
+ * @brief 			- Starts the DWT cycle counter and caches the HCLK cycles per ms
+ * @retval 			- None
+ * Note				- Called automatically by the first MCAL_DWT_Timeout_Start()
+ * 					- Call it again after any change of the clock tree
+ */
+void MCAL_DWT_Init(void){
+	if(!(DWT_CTRL & 1 << 0))
+		DWT_CYCCNT_ENABLE();
+
+	Global_DWT_CyclesPerMs = MCAL_RCC_GetHCLKFreq() / 1000;
+}
+
+/**================================================================
+ * @Fn				- MCAL_DWT_Timeout_Start
+ * @brief 			- Starts a bounded wait, then poll it with DWT_TIMEOUT_EXPIRED()
+ * @param [out] 	- pTimeout: wait reference point and budget
+ * @param [in] 		- timeout: allowed time in ms (DWT_TIMEOUT_MAX: never expires)
+ * @retval 			- None
+ * Note				- Budgets of 2^32 cycles or more (about 59 s at 72 MHz) never expire
+ */
+void MCAL_DWT_Timeout_Start(DWT_Timeout_t *pTimeout, uint32_t timeout){
+	if(Global_DWT_CyclesPerMs == 0)
+		MCAL_DWT_Init();
+
+	if(timeout > (0xFFFFFFFFUL / Global_DWT_CyclesPerMs))
+		pTimeout->budget = 0xFFFFFFFFUL;
+	else
+		pTimeout->budget = timeout * Global_DWT_CyclesPerMs;
+
+	pTimeout->start = DWT_CYCCNT;
+}
+
+/*******************************************************/
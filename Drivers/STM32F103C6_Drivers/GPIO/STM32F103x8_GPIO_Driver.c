@@ -17,74 +17,16 @@
 /*******************************************************/
 
 /**================================================================
- * @Fn				-Get_CRLH_Position
- * @brief 			-gets the pin position in CRL/CRH register
- * @param [in] 		-PinNumber
- * @retval 			-PinPos
- * Note				-None
+ * @Fn				-Get_Pin_Config
+ * @brief 			-gets the CNFy[1:0] MODEy[1:0] nibble of a pin mode
+ * @param [in] 		-PinConfig: mode and output speed
+ * @retval 			-4-bit value to be written at the pin position in CRL/CRH
+ * Note				-Pull-up / Pull-down also need the pin ODR bit (set by the caller)
  */
-static uint8_t Get_CRLH_Position(uint16_t PinNumber)
+static uint8_t Get_Pin_Config(const GPIO_PinConfig_t *PinConfig)
 {
-	uint8_t PinPos = 0;
-	switch (PinNumber){
-		case GPIO_PIN_0:
-		case GPIO_PIN_8:
-			PinPos = 0;
-			break;
-		case GPIO_PIN_1:
-		case GPIO_PIN_9:
-			PinPos = 4;
-			break;
-		case GPIO_PIN_2:
-		case GPIO_PIN_10:
-			PinPos = 8;
-			break;
-		case GPIO_PIN_3:
-		case GPIO_PIN_11:
-			PinPos = 12;
-			break;
-		case GPIO_PIN_4:
-		case GPIO_PIN_12:
-			PinPos = 16;
-			break;
-		case GPIO_PIN_5:
-		case GPIO_PIN_13:
-			PinPos = 20;
-			break;
-		case GPIO_PIN_6:
-		case GPIO_PIN_14:
-			PinPos = 24;
-			break;
-		case GPIO_PIN_7:
-		case GPIO_PIN_15:
-			PinPos = 28;
-			break;
-		default :
-			/* Do nothing */
-			break;
-	}
-	return PinPos;
-}
-
-/**================================================================
- * @Fn				-MCAL_GPIO_Init
- * @brief 			-Initializes the GPIOx PINy periphral according to the specified parameters in the PinConfiguration
- * @param [in] 		-GPIOx: Where x can be (A..E depending on device used) to select the GPIO peripheral
- * @param [in] 		-PinConfig pointer to a GPIO_PinConfig_t structure that contains the configuration information for the specified GPIO peripheral
- * @retval 			-None
- * Note				-Stm32F103C6 MCU has GPIO A,B,C,D,E Modules But LQFP48 Package has only GPIO A,B,Part of C,D exported as external PINS from the MCU
- */
-void MCAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_PinConfig_t *PinConfig){
-	/**
-	 * Port configuration register low (GPIOx_CRL) Configure PINS from 0 >> 7
-	 * Port configuration register high (GPIOx_CRH) Configure PINS from 8 >> 15
-	 */
-	volatile uint32_t *ConfigRegister = (PinConfig->pinNumber < GPIO_PIN_8) ? &GPIOx->CRL : &GPIOx->CRH;
 	uint8_t pin_config = 0;
 
-	/* clear CNFx[1:0] MODEx[1:0] [4 bits] */
-	*ConfigRegister &= ~(0xf << Get_CRLH_Position(PinConfig->pinNumber));
-
 	/* check if output mode */
 	if(
 			(PinConfig->mode == GPIO_MODE_OUTPUT_PP)	||
@@ -105,20 +47,81 @@ void MCAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_PinConfig_t *PinConfig){
 			pin_config = ( (GPIO_MODE_INPUT_FLOATING << 2) & 0x0f);
 		}
 		else{
+			/* Pull-up and Pull-down share CNF = 10, PxODR selects between them */
 			pin_config = ( (GPIO_MODE_INPUT_PU << 2) & 0x0f);
-			//to select between PullUp and PullDown modes
-			if(PinConfig->mode == GPIO_MODE_INPUT_PU){
-				/* Table 20. Port bit configuration table : PxODR -> 0 */
-				GPIOx->ODR |= (PinConfig->pinNumber);
-			}
-			else{
-				/* Table 20. Port bit configuration table : PxODR -> 1 */
-				GPIOx->ODR &= ~(PinConfig->pinNumber);
-			}
 		}
 	}
-	/* write on CRL or CRH */
-	*ConfigRegister |= ((pin_config) << Get_CRLH_Position(PinConfig->pinNumber));
+	return pin_config;
+}
+
+/**================================================================
+ * @Fn				-MCAL_GPIO_Init
+ * @brief 			-Initializes the GPIOx PINy periphral according to the specified parameters in the PinConfiguration
+ * @param [in] 		-GPIOx: Where x can be (A..E depending on device used) to select the GPIO peripheral
+ * @param [in] 		-PinConfig pointer to a GPIO_PinConfig_t structure that contains the configuration information for the specified GPIO peripheral
+ * @retval 			-None
+ * Note				-Stm32F103C6 MCU has GPIO A,B,C,D,E Modules But LQFP48 Package has only GPIO A,B,Part of C,D exported as external PINS from the MCU
+ * 					-pinNumber can hold several pins, they all take the same mode
+ */
+void MCAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_PinConfig_t *PinConfig){
+	MCAL_GPIO_InitPins(GPIOx, PinConfig, 1);
+}
+
+/**================================================================
+ * @Fn				-MCAL_GPIO_InitPins
+ * @brief 			-Initializes many pins of GPIOx with one store per configuration register
+ * @param [in] 		-GPIOx: Where x can be (A..E depending on device used) to select the GPIO peripheral
+ * @param [in] 		-PinConfigs: table of configurations, each pinNumber can be an OR of @ref GPIO_PIN_define
+ * @param [in] 		-count: number of entries in PinConfigs
+ * @retval 			-None
+ * Note				-The CRL / CRH / ODR images are built first then each register is written once
+ * 					 (pull selection through BSRR, then CRL, then CRH): pins of one register switch together
+ * 					-A pin found in several entries takes the last one
+ */
+void MCAL_GPIO_InitPins(GPIO_TypeDef *GPIOx, const GPIO_PinConfig_t *PinConfigs, uint8_t count){
+	/**
+	 * Port configuration register low (GPIOx_CRL) Configure PINS from 0 >> 7
+	 * Port configuration register high (GPIOx_CRH) Configure PINS from 8 >> 15
+	 */
+	uint32_t CRL = GPIOx->CRL;
+	uint32_t CRH = GPIOx->CRH;
+	uint16_t pins = 0, pullUp = 0, pullDown = 0;
+	uint8_t pin_config, entry, pin;
+
+	for(entry = 0; entry < count; entry++){
+		pin_config = Get_Pin_Config(&PinConfigs[entry]);
+
+		for(pin = 0; pin < 16; pin++){
+			if(!(PinConfigs[entry].pinNumber & (1 << pin)))
+				continue;
+
+			/* clear CNFx[1:0] MODEx[1:0] [4 bits] then write */
+			if(pin < 8)
+				CRL = (CRL & ~(0xFUL << (pin * 4))) | ((uint32_t)pin_config << (pin * 4));
+			else
+				CRH = (CRH & ~(0xFUL << ((pin - 8) * 4))) | ((uint32_t)pin_config << ((pin - 8) * 4));
+		}
+
+		/* Table 20. Port bit configuration table : PxODR -> 1 Pull-up, 0 Pull-down */
+		pullUp &= ~(PinConfigs[entry].pinNumber);
+		pullDown &= ~(PinConfigs[entry].pinNumber);
+		if(PinConfigs[entry].mode == GPIO_MODE_INPUT_PU)
+			pullUp |= PinConfigs[entry].pinNumber;
+		else if(PinConfigs[entry].mode == GPIO_MODE_INPUT_PD)
+			pullDown |= PinConfigs[entry].pinNumber;
+
+		pins |= PinConfigs[entry].pinNumber;
+	}
+
+	/* Pull selected before the pins become inputs: no glitch on the wrong pull */
+	if(pullUp | pullDown)
+		GPIOx->BSRR = (uint32_t)pullUp | ((uint32_t)pullDown << 16);
+
+	if(pins & 0x00FF)
+		GPIOx->CRL = CRL;
+
+	if(pins & 0xFF00)
+		GPIOx->CRH = CRH;
 }
 
 /**================================================================
@@ -207,22 +210,38 @@ void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t PinNumber, uint8_t value){
  * @param [in] 		-GPIOx: Where x can be (A..G depending on device used) to select the GPIO peripheral
  * @param [in]		-value: value to be written on the port
  * @retval 			-None
- * Note				-None
+ * Note				-All 16 pins are written, use MCAL_GPIO_WriteMasked() to change a subset
  */
 void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16_t value){
 	GPIOx->ODR = value;
 }
 
+/**================================================================
+ * @Fn				-MCAL_GPIO_WriteMasked
+ * @brief 			-Write a subset of the port pins in one BSRR store
+ * @param [in] 		-GPIOx: Where x can be (A..G depending on device used) to select the GPIO peripheral
+ * @param [in]		-mask: pins to write (any OR of @ref GPIO_PIN_define), the other pins are untouched
+ * @param [in]		-value: new level of the masked pins (bit y for pin y)
+ * @retval 			-None
+ * Note				-No read-modify-write: safe against ISRs writing other pins of the same port
+ * 					 and all masked pins change on the same APB2 cycle
+ */
+void MCAL_GPIO_WriteMasked(GPIO_TypeDef *GPIOx, uint16_t mask, uint16_t value){
+	/* Bits 15:0 BSy set, Bits 31:16 BRy reset */
+	GPIOx->BSRR = (uint32_t)(mask & value) | ((uint32_t)(mask & ~value) << 16);
+}
+
 /**================================================================
  * @Fn				-MCAL_GPIO_TogglePin
  * @brief 			-Toggle The Specified GPIO pin
  * @param [in] 		-GPIOx: Where x can be (A..G depending on device used) to select the GPIO peripheral
  * @param [in]		-PinNumber: specifies the port bit to read. Set By @ref GPIO_PINS_define
  * @retval 			-None
- * Note				-None
+ * Note				-Several pins can be toggled at once, the write is a single BSRR store so
+ * 					 ISRs writing other pins of the port are never undone
  */
 void MCAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t PinNumber){
-	GPIOx->ODR ^= (uint32_t)PinNumber;
+	MCAL_GPIO_WriteMasked(GPIOx, PinNumber, (uint16_t)~GPIOx->ODR);
 }
 
 /**================================================================
@@ -17,6 +17,50 @@
 /*******************************************************/
 I2C_Config_t G_I2C_Config[2] = {0};
 
+/**
+ * Interrupt driven master transfer phases
+ */
+typedef enum
+{
+	I2C_MASTER_IDLE,
+	I2C_MASTER_WAIT_SB,		// EV5: start (or repeated start) requested
+	I2C_MASTER_WAIT_ADDR,	// EV6: address sent, waiting for the slave ACK
+	I2C_MASTER_TX,			// EV8: writing pTxData
+	I2C_MASTER_RX,			// EV7: reading pRxData
+	I2C_MASTER_DMA_TX,		// DMA writing pTxData (event interrupt off)
+	I2C_MASTER_DMA_RX,		// DMA reading pRxData (event interrupt off)
+	I2C_MASTER_WAIT_BTF		// DMA TX done, waiting for the last byte on the bus
+}I2C_Master_Phase;
+
+typedef struct
+{
+	volatile I2C_Master_Phase phase;
+	uint16_t Device_Address;
+	const uint8_t *pTxData;
+	uint16_t TxLength;		// bytes still to be written
+	uint8_t *pRxData;
+	uint16_t RxLength;		// bytes still to be read
+	uint8_t DMA_Mode;		// 1: data bytes moved by DMA1
+	void (*P_Master_CallBack)(Master_State state);
+}I2C_Master_Handle_t;
+
+/**
+ * index [0] --> I2C1
+ * index [1] --> I2C2
+ */
+static I2C_Master_Handle_t G_I2C_Master[2];
+
+/**
+ * DMA1 channels serving the I2C requests (RM0008 Table 78)
+ * index [0] --> I2C1 --> TX Channel6 / RX Channel7
+ * index [1] --> I2C2 --> TX Channel4 / RX Channel5
+ */
+static DMA_Channel_TypeDef * const G_I2C_DMA_TxChannel[2] = {DMA_Request_I2C1_TX, DMA_Request_I2C2_TX};
+static DMA_Channel_TypeDef * const G_I2C_DMA_RxChannel[2] = {DMA_Request_I2C1_RX, DMA_Request_I2C2_RX};
+
+/* 1: a clock change arrived while the I2C was busy, CCR / TRISE are reprogrammed once it is idle */
+static volatile uint8_t G_I2C_Retime_Pending[2] = {0};
+
 /*******************************************************/
 
 /*******************************************************/
@@ -27,6 +71,411 @@ I2C_Config_t G_I2C_Config[2] = {0};
 
 /*******************************************************/
 
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
+/**===============================================================================================
+ * @FName			- I2C_Wait_Flag
+ * @Brief 			- Bounded wait until the passed flag / event is set
+ * @Parameter [in] 	- I2Cx: where x can be (1..2 depending on device used) to select I2C peripheral
+ * @Parameter [in] 	- Flag: flag or event to wait for
+ * @Parameter [in] 	- pTimer: budget computed once by the caller, restarted here
+ * @Return Value	- MCAL_OK, MCAL_TIMEOUT
+ * Note				- NONE
+ */
+static MCAL_Status_t I2C_Wait_Flag(I2C_Typedef *I2Cx, Status Flag, DWT_Timeout_t *pTimer){
+	DWT_TIMEOUT_RESTART(*pTimer);
+
+	while(!(I2C_Get_FlagStatus(I2Cx, Flag))){
+		if(DWT_TIMEOUT_EXPIRED(*pTimer))
+			return MCAL_TIMEOUT;
+	}
+
+	return MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- I2C_Check_Timing
+ * @Brief 			- Checks that the requested SCL speed can be generated from PCLK1
+ * @Parameter [in] 	- pI2C_Config: speed and mode
+ * @Parameter [in] 	- Pclk1: APB1 frequency
+ * @Return Value	- MCAL_OK, MCAL_ERROR
+ * Note				- NONE
+ */
+static MCAL_Status_t I2C_Check_Timing(const I2C_Config_t *pI2C_Config, uint32_t Pclk1){
+	/* FREQ[5:0] allowed range is 2 MHz to 36 MHz */
+	if((Pclk1 < 2000000) || (Pclk1 > 36000000) || (pI2C_Config->clockSpeed == 0))
+		return MCAL_ERROR;
+
+	if(pI2C_Config->masterMode == I2C_MASTER_MODE_FM){
+		/* Fm mode: up to 400 kHz, PCLK1 must be at least 4 MHz */
+		if((pI2C_Config->clockSpeed > I2C_CLOCK_SPEED_400KHZ) || (Pclk1 < 4000000))
+			return MCAL_ERROR;
+	}
+	else{
+		/* Sm mode: up to 100 kHz, CCR must be >= 0x04 */
+		if((pI2C_Config->clockSpeed > I2C_CLOCK_SPEED_100KHZ) || ((Pclk1 / (pI2C_Config->clockSpeed << 1)) < 4))
+			return MCAL_ERROR;
+	}
+
+	return MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- I2C_Set_Timing
+ * @Brief 			- Programs FREQ, CCR and TRISE for the requested SCL speed
+ * @Parameter [in] 	- I2Cx: where x can be (1..2 depending on device used) to select I2C peripheral
+ * @Parameter [in] 	- pI2C_Config: speed and mode
+ * @Parameter [in] 	- Pclk1: APB1 frequency, checked by I2C_Check_Timing()
+ * @Return Value	- NONE
+ * Note				- Leaves the peripheral disabled (CCR can only be written while PE = 0)
+ */
+static void I2C_Set_Timing(I2C_Typedef *I2Cx, const I2C_Config_t *pI2C_Config, uint32_t Pclk1){
+	uint16_t Temp_Register = 0 , Freq_Range = 0;
+	uint16_t Result = 0;
+
+	/*
+	 * --- I2C_CR2 -> Bits 5:0 FREQ[5:0]: Peripheral clock frequency
+	 */
+	/* 1. Get the I2Cx "CR2" Control register 2 Value */
+	Temp_Register = I2Cx->CR2;
+
+	/* 2. Clear frequency -> FREQ[5:0] bits */
+	Temp_Register &= ~(I2C_CR2_FREQ_Msk); // (0x3FUL << 0)
+
+	/* 3. Pclk1 frequency value already checked by I2C_Check_Timing() */
+
+	/* 4. Set frequency bits depending in Pclk1 value */
+	Freq_Range = (uint16_t)(Pclk1/1000000);
+
+	/* 5. Move the configuration in the temp register to set it in the CR2 register */
+	Temp_Register |= Freq_Range;
+
+	/* 6. Set the "CR2" register with our new value */
+	I2Cx->CR2 = Temp_Register;
+
+	/* ========= Configure "I2C_CCR" Clock control register ========= */
+
+	/* 7. Disable the selected I2C peripheral to configure time */
+	I2Cx->CR1 &= ~(I2C_CR1_PE);
+
+	/* 8. Put the temp register with zero ready to put data on it */
+	Temp_Register = 0;
+
+	/* 9. Configure the speed in the standard mode / Fast Mode */
+	if(pI2C_Config->masterMode != I2C_MASTER_MODE_FM)
+	{
+		/* 10. Enable standard mode but its zero as default */
+
+		/* 11. Put the standard mode calculation */
+		/*
+		 * Tclk / 2 = CCR * Tpclk1
+		 * CCR = Tclk / (2 * Tpclk1)
+		 * CCR = Fpclk / (2 * I2C_ClockFrequency)
+		 */
+		Result = (uint16_t)(Pclk1/(pI2C_Config->clockSpeed << 1));
+
+		/* 12. Move the configuration in the temp register to set it in the I2C_CCR register */
+		Temp_Register |= Result;
+
+		/* 13. Set the "I2C_CCR" register with our new value */
+		I2Cx->CCR = Temp_Register;
+
+		/* ========= Configure "I2C_TRISE" Rise time register ============ */
+		/*
+		 * For instance: in Sm mode, the maximum allowed SCL rise time is 1000 ns.
+		 * If, in the I2C_CR2 register, the value of FREQ[5:0] bits is equal to 0x08 and TPCLK1 = 125 ns
+		 * therefore the TRISE[5:0] bits must be programmed with 09h.
+		 * (1000 ns / 125 ns = 8 + 1)
+		 */
+		/* 14. Set the "I2C_TRISE" register with "Frequency Range + 1" as data sheet */
+		I2Cx->TRISE = Freq_Range + 1;
+	}
+	else
+	{
+		/* 10. Enable fast mode (F/S) and select the duty cycle */
+		Temp_Register |= (uint16_t)(I2C_MASTER_MODE_FM | pI2C_Config->FM_Duty);
+
+		/* 11. Put the fast mode calculation, rounded up so SCL never exceeds the requested speed */
+		/*
+		 * DUTY = 0: Thigh = CCR * Tpclk1, Tlow = 2 * CCR * Tpclk1
+		 * 		CCR = Fpclk / (3 * I2C_ClockFrequency)
+		 * DUTY = 1: Thigh = 9 * CCR * Tpclk1, Tlow = 16 * CCR * Tpclk1
+		 * 		CCR = Fpclk / (25 * I2C_ClockFrequency)
+		 */
+		if(pI2C_Config->FM_Duty == I2C_FM_DUTY_16_9)
+			Result = (uint16_t)((Pclk1 + (25 * pI2C_Config->clockSpeed) - 1) / (25 * pI2C_Config->clockSpeed));
+		else
+			Result = (uint16_t)((Pclk1 + (3 * pI2C_Config->clockSpeed) - 1) / (3 * pI2C_Config->clockSpeed));
+
+		/* CCR minimum value in Fm mode is 0x01 */
+		if(Result == 0)
+			Result = 1;
+
+		/* 12. Move the configuration in the temp register to set it in the I2C_CCR register */
+		Temp_Register |= Result;
+
+		/* 13. Set the "I2C_CCR" register with our new value */
+		I2Cx->CCR = Temp_Register;
+
+		/* ========= Configure "I2C_TRISE" Rise time register ============ */
+		/*
+		 * In Fm mode, the maximum allowed SCL rise time is 300 ns.
+		 * TRISE = (300 ns / Tpclk1) + 1 = (FREQ * 300 / 1000) + 1
+		 */
+		/* 14. Set the "I2C_TRISE" register */
+		I2Cx->TRISE = ((Freq_Range * 300) / 1000) + 1;
+	}
+}
+
+/**===============================================================================================
+ * @FName			- I2C_Retime
+ * @Brief 			- Reprograms CCR / TRISE from the current PCLK1, or defers it while the I2C is busy
+ * @Parameter [in] 	- index: I2C index (0 --> I2C1, 1 --> I2C2)
+ * @Parameter [in] 	- I2Cx: I2C instance of this index
+ * @Return Value	- NONE
+ * Note				- CCR needs PE = 0, which aborts any transfer and clears ACK, so it only runs while
+ * 					  no master transfer is ongoing and the bus is free (SR2.BUSY = 0)
+ * 					- A deferred retime is retried at the next master start, master completion and slave stop
+ * 					- An I2C whose speed can not be generated from the new PCLK1 stays disabled
+ */
+static void I2C_Retime(uint8_t index, I2C_Typedef *I2Cx){
+	uint32_t Pclk1;
+
+	if((G_I2C_Master[index].phase != I2C_MASTER_IDLE) || (I2Cx->SR2 & I2C_SR2_BUSY)){
+		G_I2C_Retime_Pending[index] = 1;
+		return;
+	}
+
+	G_I2C_Retime_Pending[index] = 0;
+	Pclk1 = MCAL_RCC_GetPCLK1Freq();
+
+	if(I2C_Check_Timing(&G_I2C_Config[index], Pclk1) == MCAL_OK){
+		I2C_Set_Timing(I2Cx, &G_I2C_Config[index], Pclk1);
+		I2Cx->CR1 |= I2C_CR1_PE;
+
+		/* ACK is cleared by hardware while PE = 0 */
+		if(G_I2C_Config[index].ACK_Control == I2C_ACK_CONTROL_ENABLE)
+			I2C_ACKConfig(I2Cx, Enable);
+	}
+	else{
+		I2Cx->CR1 &= ~(I2C_CR1_PE);
+	}
+}
+
+/**===============================================================================================
+ * @FName			- I2C_ClockChange_CallBack
+ * @Brief 			- Recomputes CCR / TRISE of every initialized I2C after a clock change
+ * @Parameter [in] 	- pClocks: new bus frequencies
+ * @Return Value	- NONE
+ * Note				- Subscribed to the RCC driver by MCAL_I2C_Init()
+ * 					- Deferred by I2C_Retime() while a transfer is ongoing
+ */
+static void I2C_ClockChange_CallBack(const RCC_Clocks_t *pClocks){
+	I2C_Typedef * const I2Cx[2] = {I2C1, I2C2};
+	uint8_t index;
+
+	(void)pClocks;
+
+	for(index = 0; index < 2; index++){
+		if(G_I2C_Config[index].clockSpeed == 0)
+			continue;
+
+		I2C_Retime(index, I2Cx[index]);
+	}
+}
+
+/**===============================================================================================
+ * @FName			- I2C_Master_Complete
+ * @Brief 			- Ends the interrupt driven master transfer and reports it to the application
+ * @Parameter [in] 	- index: I2C index (0 --> I2C1, 1 --> I2C2)
+ * @Parameter [in] 	- I2Cx: I2C instance of this index
+ * @Parameter [in] 	- state: transfer result passed to P_Master_CallBack
+ * @Return Value	- NONE
+ * Note				- Interrupts stay enabled if the slave interrupt mode is configured
+ */
+static void I2C_Master_Complete(uint8_t index, I2C_Typedef *I2Cx, Master_State state){
+	I2C_Master_Handle_t *handle = &G_I2C_Master[index];
+
+	if(handle->DMA_Mode){
+		I2Cx->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST);
+		if(handle->TxLength != 0){
+			MCAL_DMA_Stop(G_I2C_DMA_TxChannel[index]);
+			MCAL_DMA_Release(G_I2C_DMA_TxChannel[index], I2Cx);
+		}
+		else{
+			MCAL_DMA_Stop(G_I2C_DMA_RxChannel[index]);
+			MCAL_DMA_Release(G_I2C_DMA_RxChannel[index], I2Cx);
+		}
+		handle->DMA_Mode = 0;
+	}
+
+	I2Cx->CR1 &= ~(I2C_CR1_POS);
+
+	/* Re-Enable the automatic ACK */
+	if(G_I2C_Config[index].ACK_Control == I2C_ACK_CONTROL_ENABLE)
+		I2C_ACKConfig(I2Cx, Enable);
+	else
+		I2C_ACKConfig(I2Cx, Disable);
+
+	if(G_I2C_Config[index].P_Slave_CallBack == NULL)
+		I2Cx->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
+	else
+		I2Cx->CR2 |= (I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN); /* ITEVTEN is off after a DMA EV6 */
+
+	handle->phase = I2C_MASTER_IDLE;
+
+	/* Deferred again if the stop condition is still on the bus */
+	if(G_I2C_Retime_Pending[index])
+		I2C_Retime(index, I2Cx);
+
+	handle->P_Master_CallBack(state);
+}
+
+/**===============================================================================================
+ * @FName			- I2C_DMA_Complete
+ * @Brief 			- Common DMA TC / TE handling of the I2C master DMA transfers
+ * @Parameter [in] 	- index: I2C index (0 --> I2C1, 1 --> I2C2)
+ * @Parameter [in] 	- I2Cx: I2C instance of this index
+ * @Parameter [in] 	- irq_src: DMA interrupt source
+ * @Return Value	- NONE
+ * Note				- Called from the DMA interrupt
+ */
+static void I2C_DMA_Complete(uint8_t index, I2C_Typedef *I2Cx, struct S_DMA_IRQ_SRC irq_src){
+	I2C_Master_Handle_t *handle = &G_I2C_Master[index];
+
+	if(irq_src.TE){
+		I2C_Stop(I2Cx, Enable);
+		I2C_Master_Complete(index, I2Cx, I2C_MASTER_DMA_ERR);
+	}
+	else if(handle->phase == I2C_MASTER_DMA_TX){
+		/* Last byte is in DR, wait for BTF before the stop so it is not cut */
+		handle->phase = I2C_MASTER_WAIT_BTF;
+		I2Cx->CR2 |= I2C_CR2_ITEVTEN;
+	}
+	else if(handle->phase == I2C_MASTER_DMA_RX){
+		/* LAST already NACKed the final byte, single byte stop was programmed at EV6 */
+		if(handle->RxLength > 1)
+			I2C_Stop(I2Cx, Enable);
+		I2C_Master_Complete(index, I2Cx, I2C_MASTER_DONE);
+	}
+}
+
+static void I2C1_DMA_CallBack(struct S_DMA_IRQ_SRC irq_src){
+	I2C_DMA_Complete(I2C1_Index, I2C1, irq_src);
+}
+
+static void I2C2_DMA_CallBack(struct S_DMA_IRQ_SRC irq_src){
+	I2C_DMA_Complete(I2C2_Index, I2C2, irq_src);
+}
+
+/**===============================================================================================
+ * @FName			- I2C_DMA_Setup
+ * @Brief 			- Configures and arms the DMA1 channel of the pending master transfer
+ * @Parameter [in] 	- index: I2C index (0 --> I2C1, 1 --> I2C2)
+ * @Parameter [in] 	- I2Cx: I2C instance of this index
+ * @Return Value	- NONE
+ * Note				- The channel only moves data once DMAEN is set and ADDR is cleared
+ */
+static void I2C_DMA_Setup(uint8_t index, I2C_Typedef *I2Cx){
+	I2C_Master_Handle_t *handle = &G_I2C_Master[index];
+	DMA_Config_t DMA_Cfg;
+
+	DMA_Cfg.priority = DMA_Priority_High;
+	DMA_Cfg.periphSize = DMA_PeriphSize_8bits;
+	DMA_Cfg.memSize = DMA_MemSize_8bits;
+	DMA_Cfg.periphInc = DMA_PeriphInc_Disable;
+	DMA_Cfg.memInc = DMA_MemInc_Enable;
+	DMA_Cfg.mode = DMA_Mode_Normal;
+	DMA_Cfg.IRQ_EN = DMA_IRQ_TC | DMA_IRQ_TE;
+	DMA_Cfg.P_IRQ_CallBack = (index == I2C1_Index) ? I2C1_DMA_CallBack : I2C2_DMA_CallBack;
+
+	if(handle->TxLength != 0){
+		/* pTxData (byte, incremented) --> I2Cx->DR (byte, fixed) */
+		DMA_Cfg.direction = DMA_Direction_MemToPeriph;
+		MCAL_DMA_Init(G_I2C_DMA_TxChannel[index], &DMA_Cfg);
+		MCAL_DMA_Start(G_I2C_DMA_TxChannel[index], (uint32_t)&I2Cx->DR, (uint32_t)handle->pTxData, handle->TxLength);
+
+		I2Cx->CR2 &= ~(I2C_CR2_LAST);
+	}
+	else{
+		/* I2Cx->DR (byte, fixed) --> pRxData (byte, incremented) */
+		DMA_Cfg.direction = DMA_Direction_PeriphToMem;
+		MCAL_DMA_Init(G_I2C_DMA_RxChannel[index], &DMA_Cfg);
+		MCAL_DMA_Start(G_I2C_DMA_RxChannel[index], (uint32_t)&I2Cx->DR, (uint32_t)handle->pRxData, handle->RxLength);
+
+		/* Next DMA EOT is the last transfer: the hardware NACKs the final byte */
+		I2Cx->CR2 |= I2C_CR2_LAST;
+	}
+
+	I2Cx->CR2 |= I2C_CR2_DMAEN;
+}
+
+/**===============================================================================================
+ * @FName			- I2C_Master_Start_IT
+ * @Brief 			- Common start of the interrupt driven master transfers
+ * @Parameter [in] 	- index: I2C index (0 --> I2C1, 1 --> I2C2)
+ * @Parameter [in] 	- I2Cx: I2C instance of this index
+ * @Parameter [in] 	- Device_Address, pTxData, TxLength, pRxData, RxLength, P_Master_CallBack: transfer description
+ * @Parameter [in] 	- DMA_Mode: 1 to move the data bytes by DMA1 (single direction only)
+ * @Return Value	- MCAL_OK, MCAL_BUSY if a transfer is ongoing, the bus is busy or the DMA channel is claimed
+ * 					  by another driver, MCAL_ERROR on wrong parameters
+ * Note				- Write phase first (if TxLength != 0) then read phase after a repeated start (if RxLength != 0)
+ */
+static MCAL_Status_t I2C_Master_Start_IT(uint8_t index, I2C_Typedef *I2Cx, uint16_t Device_Address, const uint8_t *pTxData, uint16_t TxLength, uint8_t *pRxData, uint16_t RxLength, void (*P_Master_CallBack)(Master_State state), uint8_t DMA_Mode){
+	I2C_Master_Handle_t *handle = &G_I2C_Master[index];
+
+	if((P_Master_CallBack == NULL) || ((TxLength != 0) && (pTxData == NULL)) || ((RxLength != 0) && (pRxData == NULL)))
+		return MCAL_ERROR;
+
+	if((handle->phase != I2C_MASTER_IDLE) || I2C_Get_FlagStatus(I2Cx, BUS_BUSY))
+		return MCAL_BUSY;
+
+	if(G_I2C_Retime_Pending[index])
+		I2C_Retime(index, I2Cx);
+
+	if(DMA_Mode && (MCAL_DMA_Claim((TxLength != 0) ? G_I2C_DMA_TxChannel[index] : G_I2C_DMA_RxChannel[index], I2Cx) != MCAL_OK))
+		return MCAL_BUSY;
+
+	handle->Device_Address = Device_Address;
+	handle->pTxData = pTxData;
+	handle->TxLength = TxLength;
+	handle->pRxData = pRxData;
+	handle->RxLength = RxLength;
+	handle->P_Master_CallBack = P_Master_CallBack;
+	handle->DMA_Mode = DMA_Mode;
+	handle->phase = I2C_MASTER_WAIT_SB;
+
+	if(DMA_Mode){
+		/* Data bytes are moved on TxE / RxNE DMA requests, only events and errors interrupt the CPU */
+		I2C_DMA_Setup(index, I2Cx);
+		I2Cx->CR2 &= ~(I2C_CR2_ITBUFEN);
+		I2Cx->CR2 |= (I2C_CR2_ITEVTEN | I2C_CR2_ITERREN);
+	}
+	else{
+		/* Enable event, buffer and error interrupts */
+		I2Cx->CR2 |= (I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
+	}
+
+	if(I2Cx == I2C1)
+	{
+		NVIC_IRQ31_I2C1_EV_IRQ_EN();
+		NVIC_IRQ32_I2C1_ER_IRQ_EN();
+	}
+	else if (I2Cx == I2C2)
+	{
+		NVIC_IRQ33_I2C2_EV_IRQ_EN();
+		NVIC_IRQ34_I2C2_ER_IRQ_EN();
+	}
+
+	/* Generate a START condition, the rest runs in I2Cx_EV_IRQHandler */
+	BITBAND_PERIPH(I2Cx->CR1, I2C_CR1_START_Pos) = 1;
+
+	return MCAL_OK;
+}
+
+/*******************************************************/
+
 /*******************************************************/
 /******* APIs Supported by "MCAL I2C DRIVER" ***********/
 /*******************************************************/
@@ -36,14 +485,20 @@ I2C_Config_t G_I2C_Config[2] = {0};
  * @brief 			- Initializes I2Cx according to the specified parameters in I2C_Config
  * @param [in] 		- I2Cx : where x can be (1..2 depending on device used) to select I2C peripheral
  * @param [in] 		- I2C_Config : a pointer to I2C_Config_t structure that contains the configuration information for the specified I2C Module
- * @retval 			- None
- * Note 			- Supported for I2C SM mode only
+ * @retval 			- MCAL_OK, MCAL_ERROR if the speed can not be generated from the current PCLK1
+ * Note 			- Sm mode (50 / 100 kHz) needs PCLK1 >= 2 MHz, Fm mode (400 kHz) needs PCLK1 >= 4 MHz
+ * 					- CCR / TRISE follow later clock changes made through the RCC driver
  * 					- Support only 7-bit address mode
  */
-void MCAL_I2C_Init(I2C_Typedef *I2Cx, I2C_Config_t *I2C_Config){
-	uint16_t Temp_Register = 0 , Freq_Range = 0;
+MCAL_Status_t MCAL_I2C_Init(I2C_Typedef *I2Cx, I2C_Config_t *I2C_Config){
+	uint16_t Temp_Register = 0;
 	uint32_t Pclk1 = 8000000;
-	uint16_t Result = 0;
+
+	/* 0. Check the requested speed against PCLK1 before touching the peripheral */
+	Pclk1 = MCAL_RCC_GetPCLK1Freq();
+
+	if(I2C_Check_Timing(I2C_Config, Pclk1) != MCAL_OK)
+		return MCAL_ERROR;
 
 	/* 1. Enable the RCC Clock */
 	if(I2Cx == I2C1){
@@ -65,68 +520,7 @@ void MCAL_I2C_Init(I2C_Typedef *I2Cx, I2C_Config_t *I2C_Config){
 	if(I2C_Config->mode == I2C_MODE_I2C_MODE)
 	{
 		/* =================== Initialize Timing ==================== */
-		/*
-		 * --- I2C_CR2 -> Bits 5:0 FREQ[5:0]: Peripheral clock frequency
-		 */
-		/* 1. Get the I2Cx "CR2" Control register 2 Value */
-		Temp_Register = I2Cx->CR2;
-
-		/* 2. Clear frequency -> FREQ[5:0] bits */
-		Temp_Register &= ~(I2C_CR2_FREQ_Msk); // (0x3FUL << 0)
-
-		/* 3. Get Pclk1 frequency value */
-		Pclk1 = MCAL_RCC_GetPCLK1Freq();
-
-		/* 4. Set frequency bits depending in Pclk1 value */
-		Freq_Range = (uint16_t)(Pclk1/1000000);
-
-		/* 5. Move the configuration in the temp register to set it in the CR2 register */
-		Temp_Register |= Freq_Range;
-
-		/* 6. Set the "CR2" register with our new value */
-		I2Cx->CR2 = Temp_Register;
-
-		/* ========= Configure "I2C_CCR" Clock control register ========= */
-
-		/* 7. Disable the selected I2C peripheral to configure time */
-		I2Cx->CR1 &= ~(I2C_CR1_PE);
-
-		/* 8. Put the temp register with zero ready to put data on it */
-		Temp_Register = 0;
-
-		/* 9. Configure the speed in the standard mode / Fast Mode */
-		if((I2C_Config->clockSpeed == I2C_CLOCK_SPEED_50KHZ)||(I2C_Config->clockSpeed == I2C_CLOCK_SPEED_100KHZ))
-		{
-			/* 10. Enable standard mode but its zero as default */
-
-			/* 11. Put the standard mode calculation */
-			/*
-			 * Tclk / 2 = CCR * Tpclk1
-			 * CCR = Tclk / (2 * Tpclk1)
-			 * CCR = Fpclk / (2 * I2C_ClockFrequency)
-			 */
-			Result = (uint16_t)(Pclk1/(I2C_Config->clockSpeed << 1));
-
-			/* 12. Move the configuration in the temp register to set it in the I2C_CCR register */
-			Temp_Register |= Result;
-
-			/* 13. Set the "I2C_CCR" register with our new value */
-			I2Cx->CCR = Temp_Register;
-
-			/* ========= Configure "I2C_TRISE" Rise time register ============ */
-			/*
-			 * For instance: in Sm mode, the maximum allowed SCL rise time is 1000 ns.
-			 * If, in the I2C_CR2 register, the value of FREQ[5:0] bits is equal to 0x08 and TPCLK1 = 125 ns
-			 * therefore the TRISE[5:0] bits must be programmed with 09h.
-			 * (1000 ns / 125 ns = 8 + 1)
-			 */
-			/* 14. Set the "I2C_TRISE" register with "Frequency Range + 1" as data sheet */
-			I2Cx->TRISE = Freq_Range + 1;
-		}
-		else
-		{
-			/* Fast Mode not supported */
-		}
+		I2C_Set_Timing(I2Cx, I2C_Config, Pclk1);
 
 		/* =================== End Timing Initialization  ==================== */
 
@@ -212,6 +606,11 @@ void MCAL_I2C_Init(I2C_Typedef *I2Cx, I2C_Config_t *I2C_Config){
 
 	/* 4. Enable the selected I2C peripheral */
 	I2Cx->CR1 |= I2C_CR1_PE;
+
+	/* 5. Keep the SCL timing right on clock changes */
+	MCAL_RCC_Subscribe(I2C_ClockChange_CallBack);
+
+	return MCAL_OK;
 }
 
 /* ================================================================
@@ -226,11 +625,19 @@ void MCAL_I2C_DeInit(I2C_Typedef *I2Cx){
 		NVIC_IRQ31_I2C1_EV_IRQ_DISABLE();
 		NVIC_IRQ32_I2C1_ER_IRQ_DISABLE();
 		RCC_I2C1_CLK_RST();
+		G_I2C_Retime_Pending[I2C1_Index] = 0;
+
+		/* No clock speed --> skipped on clock changes */
+		G_I2C_Config[I2C1_Index].clockSpeed = 0;
 	}
 	else if(I2Cx == I2C2){
 		NVIC_IRQ33_I2C2_EV_IRQ_DISABLE();
 		NVIC_IRQ34_I2C2_ER_IRQ_DISABLE();
 		RCC_I2C2_CLK_RST();
+		G_I2C_Retime_Pending[I2C2_Index] = 0;
+
+		/* No clock speed --> skipped on clock changes */
+		G_I2C_Config[I2C2_Index].clockSpeed = 0;
 	}
 }
 
@@ -247,31 +654,18 @@ void MCAL_I2C_GPIO_Set_Pins(I2C_Typedef *I2Cx){
 
 	/* Depending the recommendation in data sheet -> Table 27. I2C 	*/
 	/*  "I2C pin-out"    "Configuration"     "GPIO configuration" 	*/
+	I2C_GPIO_Config.mode = GPIO_MODE_OUTPUT_AF_OD;
+	I2C_GPIO_Config.outputSpeed = GPIO_SPEED_10M;
+
 	if(I2Cx == I2C1){
-		/* PB6 : I2C1_SCL */
-		I2C_GPIO_Config.pinNumber = GPIO_PIN_6;
-		I2C_GPIO_Config.mode = GPIO_MODE_OUTPUT_AF_OD;
-		I2C_GPIO_Config.outputSpeed = GPIO_SPEED_10M;
-		MCAL_GPIO_Init(GPIOB, &I2C_GPIO_Config);
-
-		/* PB7 : I2C1_SDA */
-		I2C_GPIO_Config.pinNumber = GPIO_PIN_7;
-		I2C_GPIO_Config.mode = GPIO_MODE_OUTPUT_AF_OD;
-		I2C_GPIO_Config.outputSpeed = GPIO_SPEED_10M;
-		MCAL_GPIO_Init(GPIOB, &I2C_GPIO_Config);
+		/* PB6 : I2C1_SCL, PB7 : I2C1_SDA (both in CRL, one store) */
+		I2C_GPIO_Config.pinNumber = GPIO_PIN_6 | GPIO_PIN_7;
+		MCAL_GPIO_InitPins(GPIOB, &I2C_GPIO_Config, 1);
 	}
 	else if(I2Cx == I2C2){
-		/* PB10 : I2C2_SCL */
-		I2C_GPIO_Config.pinNumber = GPIO_PIN_10;
-		I2C_GPIO_Config.mode = GPIO_MODE_OUTPUT_AF_OD;
-		I2C_GPIO_Config.outputSpeed = GPIO_SPEED_10M;
-		MCAL_GPIO_Init(GPIOB, &I2C_GPIO_Config);
-
-		/* PB10 : I2C2_SDA */
-		I2C_GPIO_Config.pinNumber = GPIO_PIN_11;
-		I2C_GPIO_Config.mode = GPIO_MODE_OUTPUT_AF_OD;
-		I2C_GPIO_Config.outputSpeed = GPIO_SPEED_10M;
-		MCAL_GPIO_Init(GPIOB, &I2C_GPIO_Config);
+		/* PB10 : I2C2_SCL, PB11 : I2C2_SDA (both in CRH, one store) */
+		I2C_GPIO_Config.pinNumber = GPIO_PIN_10 | GPIO_PIN_11;
+		MCAL_GPIO_InitPins(GPIOB, &I2C_GPIO_Config, 1);
 	}
 }
 
@@ -284,51 +678,65 @@ void MCAL_I2C_GPIO_Set_Pins(I2C_Typedef *I2Cx){
  * @param [in] 		- Data_Length : number of data bytes to be Transmitted
  * @param [in] 		- Stop : select send stop bit or not
  * @param [in] 		- Start : select send start or repeated start
- * @retval 			- None
- * Note 			- None
+ * @retval 			- MCAL_OK, MCAL_TIMEOUT if any event is not reached within I2C_TIMEOUT_DEFAULT
+ * Note 			- On timeout a stop condition is generated to release the bus
  */
-void MCAL_I2C_MASTER_TX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pTxData, uint8_t Data_Length, STOP_Condition Stop, START_Condition Start){
+MCAL_Status_t MCAL_I2C_MASTER_TX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pTxData, uint8_t Data_Length, STOP_Condition Stop, START_Condition Start){
 	int i = 0;
+	MCAL_Status_t status = MCAL_OK;
+	DWT_Timeout_t timer;
+
+	uint8_t index = I2Cx == I2C1 ? I2C1_Index : I2C2_Index;
+
+	/* Budget computed once, every event wait below is bounded by I2C_TIMEOUT_DEFAULT */
+	MCAL_DWT_Timeout_Start(&timer, I2C_TIMEOUT_DEFAULT);
+
+	/* 0. Apply a clock change deferred while the bus was busy (kept deferred on a repeated start) */
+	if(G_I2C_Retime_Pending[index])
+		I2C_Retime(index, I2Cx);
 
-	/* TODO Support timeout (configure timer working for specific duration rise interrupt)
-	 * TODO Timer_interrupt(){flag =}
-	 * TODO so any code exist in while (check flag || any polling conditions)
-	 */
 	/* 1. Set the start bit in the I2C_CR1 register to generate a start condition from this will start as master */
-	I2C_Generate_Start(I2Cx, Start, Enable);
+	if(I2C_Generate_Start(I2Cx, Start, Enable) != MCAL_OK)
+		return MCAL_TIMEOUT;
 
 	/* 2. Wait for EV5 */
 	/* EV5: SB=1, cleared by reading SR1 register followed by writing DR register with Address. */
-	while(!(I2C_Get_FlagStatus(I2Cx, SB)));
+	status = I2C_Wait_Flag(I2Cx, SB, &timer);
 
-	/* 3. Writing DR register with Address, Send Address */
-	I2C_Send_Address(I2Cx, Device_Address, Transmitter);
+	if(status == MCAL_OK){
+		/* 3. Writing DR register with Address, Send Address */
+		I2C_Send_Address(I2Cx, Device_Address, Transmitter);
 
-	/* 4. Wait for EV6 */
-	/* EV6: ADDR=1, cleared by reading SR1 register followed by reading SR2. */
-	while(!(I2C_Get_FlagStatus(I2Cx, ADDR)));
+		/* 4. Wait for EV6 */
+		/* EV6: ADDR=1, cleared by reading SR1 register followed by reading SR2. */
+		status = I2C_Wait_Flag(I2Cx, ADDR, &timer);
+	}
 
-	/* 5. Wait for EV8_1 */
-	/* EV8_1: TxE=1, shift register empty, data register empty, write Data1 in DR. */
-	/* Check for TRA: Transmitter/receiver, BUSY: Bus busy, MSL: Master/slave, TxE Flags */
-	while(!(I2C_Get_FlagStatus(I2Cx, Master_Transmitter_Event)));
+	if(status == MCAL_OK){
+		/* 5. Wait for EV8_1 */
+		/* EV8_1: TxE=1, shift register empty, data register empty, write Data1 in DR. */
+		/* Check for TRA: Transmitter/receiver, BUSY: Bus busy, MSL: Master/slave, TxE Flags */
+		status = I2C_Wait_Flag(I2Cx, Master_Transmitter_Event, &timer);
+	}
 
 	/* Loop inside the data ready to send it */
-	for (i = 0; i < Data_Length; ++i){
+	for (i = 0; (i < Data_Length) && (status == MCAL_OK); ++i){
 		/* 6. Write in the DR register the data to be sent */
 		I2Cx->DR = pTxData[i];
 
 		/* 7. Wait for EV8 */
 		/* EV8: TxE=1, shift register not empty, data register empty, cleared by writing DR register. */
-		while(!(I2C_Get_FlagStatus(I2Cx, TXE)));
+		status = I2C_Wait_Flag(I2Cx, TXE, &timer);
 		/* 8. Wait for EV8 */
 		/* EV8_2: TxE=1, BTF = 1, Program Stop request. TxE and BTF are cleared by hardware by the Stop condition. */
 	}
 
-	/* 9. Send Stop Condition */
-	if(Stop == With_STOP){
+	/* 9. Send Stop Condition (always on timeout to release the bus) */
+	if((Stop == With_STOP) || (status != MCAL_OK)){
 		I2C_Stop(I2Cx, Enable);
 	}
+
+	return status;
 }
 
 /* ================================================================
@@ -340,42 +748,53 @@ void MCAL_I2C_MASTER_TX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pTx
  * @param [in] 		- Data_Length : number of data bytes to be Received
  * @param [in] 		- Stop : select send stop bit or not
  * @param [in] 		- Start : select send start or repeated start
- * @retval 			- None
- * Note 			- None
+ * @retval 			- MCAL_OK, MCAL_TIMEOUT if any event is not reached within I2C_TIMEOUT_DEFAULT
+ * Note 			- On timeout a stop condition is generated to release the bus
  */
-void MCAL_I2C_MASTER_RX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRxData, uint8_t Data_Length, STOP_Condition Stop, START_Condition Start){
+MCAL_Status_t MCAL_I2C_MASTER_RX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRxData, uint8_t Data_Length, STOP_Condition Stop, START_Condition Start){
 	int i = 0;
+	MCAL_Status_t status = MCAL_OK;
+	DWT_Timeout_t timer;
 
 	uint8_t index = I2Cx == I2C1 ? I2C1_Index : I2C2_Index;
-	/* TODO Support timeout (configure timer working for specific duration rise interrupt)
-	 * TODO Timer_interrupt(){flag =}
-	 * TODO so any code exist in while (check flag || any polling conditions)
-	 */
+
+	/* Budget computed once, every event wait below is bounded by I2C_TIMEOUT_DEFAULT */
+	MCAL_DWT_Timeout_Start(&timer, I2C_TIMEOUT_DEFAULT);
+
+	/* 0. Apply a clock change deferred while the bus was busy (kept deferred on a repeated start) */
+	if(G_I2C_Retime_Pending[index])
+		I2C_Retime(index, I2Cx);
+
 	/* 1. Set the start bit in the I2C_CR1 register to generate a start condition from this will start as master */
-	I2C_Generate_Start(I2Cx, Start, Enable);
+	if(I2C_Generate_Start(I2Cx, Start, Enable) != MCAL_OK)
+		return MCAL_TIMEOUT;
 
 	/* 2. Wait for EV5 */
 	/* EV5: SB=1, cleared by reading SR1 register followed by writing DR register with Address. */
-	while(!(I2C_Get_FlagStatus(I2Cx, SB)));
+	status = I2C_Wait_Flag(I2Cx, SB, &timer);
 
 	/* 3. Writing DR register with Address, Send Address */
-	I2C_Send_Address(I2Cx, Device_Address, Receiver);
+	if(status == MCAL_OK){
+		I2C_Send_Address(I2Cx, Device_Address, Receiver);
 
-	/* 4. Wait for EV6 */
-	/* EV6: ADDR=1, cleared by reading SR1 register followed by reading SR2. */
-	while(!(I2C_Get_FlagStatus(I2Cx, ADDR)));
+		/* 4. Wait for EV6 */
+		/* EV6: ADDR=1, cleared by reading SR1 register followed by reading SR2. */
+		status = I2C_Wait_Flag(I2Cx, ADDR, &timer);
+	}
 
 	/* 5. Enable Automatic ACK */
 	/* To get ready to send ACK */
 	I2C_ACKConfig(I2Cx, Enable);
 
 	/* 6. Check if there is Data length available */
-	if(Data_Length){
+	if(Data_Length && (status == MCAL_OK)){
 		/* 7. Loop inside the data to read it till length become zero */
 		for (i = Data_Length; i > 1 ; i--){
 			/* 8. Wait for EV7 */
 			/* EV7: RxNE=1 cleared by reading DR register */
-			while(!(I2C_Get_FlagStatus(I2Cx, RXNE)));
+			status = I2C_Wait_Flag(I2Cx, RXNE, &timer);
+			if(status != MCAL_OK)
+				break;
 
 			/* 9. Read the data in the DR register */
 			*pRxData = I2Cx->DR;
@@ -393,8 +812,8 @@ void MCAL_I2C_MASTER_RX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRx
 	/* Send ---- > NACK */
 	I2C_ACKConfig(I2Cx, Disable);
 
-	/* 12. Send Stop Condition */
-	if(Stop == With_STOP){
+	/* 12. Send Stop Condition (always on timeout to release the bus) */
+	if((Stop == With_STOP) || (status != MCAL_OK)){
 		I2C_Stop(I2Cx, Enable);
 	}
 
@@ -403,6 +822,108 @@ void MCAL_I2C_MASTER_RX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRx
 		I2C_ACKConfig(I2Cx, Enable);
 	else
 		I2C_ACKConfig(I2Cx, Disable);
+
+	return status;
+}
+
+/* ================================================================
+ * @Fn 				- MCAL_I2C_MASTER_TX_IT
+ * @brief 			- Master Send data with I2C without blocking
+ * @param [in] 		- I2Cx : where x can be (1..2 depending on device used) to select I2C peripheral
+ * @param [in] 		- Device_Address : slave address
+ * @param [in] 		- pTxData : a pointer to the data which will be send (must stay valid until the callback)
+ * @param [in] 		- Data_Length : number of data bytes to be Transmitted (0: address probe only)
+ * @param [in] 		- P_Master_CallBack : called from the I2C interrupt once the stop is issued or on error
+ * @retval 			- MCAL_OK if started, MCAL_BUSY if a transfer is ongoing or the bus is busy, MCAL_ERROR on wrong parameters
+ * Note 			- Support 7-bit address mode only
+ */
+MCAL_Status_t MCAL_I2C_MASTER_TX_IT(I2C_Typedef *I2Cx, uint16_t Device_Address, const uint8_t *pTxData, uint16_t Data_Length, void (*P_Master_CallBack)(Master_State state)){
+	uint8_t index = I2Cx == I2C1 ? I2C1_Index : I2C2_Index;
+
+	return I2C_Master_Start_IT(index, I2Cx, Device_Address, pTxData, Data_Length, NULL, 0, P_Master_CallBack, 0);
+}
+
+/* ================================================================
+ * @Fn 				- MCAL_I2C_MASTER_RX_IT
+ * @brief 			- Master Receive data with I2C without blocking
+ * @param [in] 		- I2Cx : where x can be (1..2 depending on device used) to select I2C peripheral
+ * @param [in] 		- Device_Address : slave address
+ * @param [out] 	- pRxData : a pointer to the received data buffer (valid once the callback reports I2C_MASTER_DONE)
+ * @param [in] 		- Data_Length : number of data bytes to be Received (at least 1)
+ * @param [in] 		- P_Master_CallBack : called from the I2C interrupt once the stop is issued or on error
+ * @retval 			- MCAL_OK if started, MCAL_BUSY if a transfer is ongoing or the bus is busy, MCAL_ERROR on wrong parameters
+ * Note 			- Support 7-bit address mode only
+ */
+MCAL_Status_t MCAL_I2C_MASTER_RX_IT(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRxData, uint16_t Data_Length, void (*P_Master_CallBack)(Master_State state)){
+	uint8_t index = I2Cx == I2C1 ? I2C1_Index : I2C2_Index;
+
+	if(Data_Length == 0)
+		return MCAL_ERROR;
+
+	return I2C_Master_Start_IT(index, I2Cx, Device_Address, NULL, 0, pRxData, Data_Length, P_Master_CallBack, 0);
+}
+
+/* ================================================================
+ * @Fn 				- MCAL_I2C_MASTER_TX_RX_IT
+ * @brief 			- Master write then read (repeated start) with I2C without blocking, e.g. register read
+ * @param [in] 		- I2Cx : where x can be (1..2 depending on device used) to select I2C peripheral
+ * @param [in] 		- Device_Address : slave address
+ * @param [in] 		- pTxData : a pointer to the data written first (e.g. register address)
+ * @param [in] 		- TxLength : number of data bytes to be Transmitted (at least 1)
+ * @param [out] 	- pRxData : a pointer to the received data buffer
+ * @param [in] 		- RxLength : number of data bytes to be Received (at least 1)
+ * @param [in] 		- P_Master_CallBack : called from the I2C interrupt once the stop is issued or on error
+ * @retval 			- MCAL_OK if started, MCAL_BUSY if a transfer is ongoing or the bus is busy, MCAL_ERROR on wrong parameters
+ * Note 			- Support 7-bit address mode only
+ */
+MCAL_Status_t MCAL_I2C_MASTER_TX_RX_IT(I2C_Typedef *I2Cx, uint16_t Device_Address, const uint8_t *pTxData, uint16_t TxLength, uint8_t *pRxData, uint16_t RxLength, void (*P_Master_CallBack)(Master_State state)){
+	uint8_t index = I2Cx == I2C1 ? I2C1_Index : I2C2_Index;
+
+	if((TxLength == 0) || (RxLength == 0))
+		return MCAL_ERROR;
+
+	return I2C_Master_Start_IT(index, I2Cx, Device_Address, pTxData, TxLength, pRxData, RxLength, P_Master_CallBack, 0);
+}
+
+/* ================================================================
+ * @Fn 				- MCAL_I2C_MASTER_TX_DMA
+ * @brief 			- Master Send a data block with I2C, data bytes moved by DMA1
+ * @param [in] 		- I2Cx : where x can be (1..2 depending on device used) to select I2C peripheral
+ * @param [in] 		- Device_Address : slave address
+ * @param [in] 		- pTxData : a pointer to the data which will be send (handed to DMA as is, must stay valid until the callback)
+ * @param [in] 		- Data_Length : number of data bytes to be Transmitted (1..65535)
+ * @param [in] 		- P_Master_CallBack : called once the last byte is on the bus and the stop is issued, or on error
+ * @retval 			- MCAL_OK if started, MCAL_BUSY if a transfer is ongoing, the bus is busy or the channel is claimed, MCAL_ERROR on wrong parameters
+ * Note 			- Claims DMA1 Channel6 (I2C1) / Channel4 (I2C2) for the transfer
+ */
+MCAL_Status_t MCAL_I2C_MASTER_TX_DMA(I2C_Typedef *I2Cx, uint16_t Device_Address, const uint8_t *pTxData, uint16_t Data_Length, void (*P_Master_CallBack)(Master_State state)){
+	uint8_t index = I2Cx == I2C1 ? I2C1_Index : I2C2_Index;
+
+	if(Data_Length == 0)
+		return MCAL_ERROR;
+
+	return I2C_Master_Start_IT(index, I2Cx, Device_Address, pTxData, Data_Length, NULL, 0, P_Master_CallBack, 1);
+}
+
+/* ================================================================
+ * @Fn 				- MCAL_I2C_MASTER_RX_DMA
+ * @brief 			- Master Receive a data block with I2C, data bytes moved by DMA1
+ * @param [in] 		- I2Cx : where x can be (1..2 depending on device used) to select I2C peripheral
+ * @param [in] 		- Device_Address : slave address
+ * @param [out] 	- pRxData : a pointer to the received data buffer (written by DMA, valid once the callback reports I2C_MASTER_DONE)
+ * @param [in] 		- Data_Length : number of data bytes to be Received (1..65535)
+ * @param [in] 		- P_Master_CallBack : called from the DMA TC interrupt once the stop is issued, or on error
+ * @retval 			- MCAL_OK if started, MCAL_BUSY if a transfer is ongoing, the bus is busy or the channel is claimed, MCAL_ERROR on wrong parameters
+ * Note 			- CR2 LAST is set so the hardware NACKs the final byte by itself (single byte: NACK at EV6)
+ * 					- Claims DMA1 Channel7 (I2C1) / Channel5 (I2C2) for the transfer
+ */
+MCAL_Status_t MCAL_I2C_MASTER_RX_DMA(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRxData, uint16_t Data_Length, void (*P_Master_CallBack)(Master_State state)){
+	uint8_t index = I2Cx == I2C1 ? I2C1_Index : I2C2_Index;
+
+	if(Data_Length == 0)
+		return MCAL_ERROR;
+
+	return I2C_Master_Start_IT(index, I2Cx, Device_Address, NULL, 0, pRxData, Data_Length, P_Master_CallBack, 1);
 }
 
 /* ================================================================
@@ -555,11 +1076,17 @@ I2C_Flagstatus I2C_Get_FlagStatus(I2C_Typedef *I2Cx, Status Flag){
 	return Bit_Status;
 }
 
-void I2C_Generate_Start(I2C_Typedef *I2Cx, START_Condition Start, Functional_State State){
+MCAL_Status_t I2C_Generate_Start(I2C_Typedef *I2Cx, START_Condition Start, Functional_State State){
 	/* Check the type of start (Start or Repeated Start) */
 	if(Start != Repeated_START){
-		/* Check if the bus is idle */
-		while(I2C_Get_FlagStatus(I2Cx, BUS_BUSY));
+		DWT_Timeout_t timer;
+
+		/* Check if the bus is idle (bounded, the bus may be held by another master or a stuck slave) */
+		MCAL_DWT_Timeout_Start(&timer, I2C_TIMEOUT_DEFAULT);
+		while(I2C_Get_FlagStatus(I2Cx, BUS_BUSY)){
+			if(DWT_TIMEOUT_EXPIRED(timer))
+				return MCAL_TIMEOUT;
+		}
 	}
 
 	/* Write start condition */
@@ -575,13 +1102,14 @@ void I2C_Generate_Start(I2C_Typedef *I2Cx, START_Condition Start, Functional_Sta
 	 */
 	if(State != Disable){
 		/* Generate a START condition */
-		I2Cx->CR1 |= I2C_CR1_START;
+		BITBAND_PERIPH(I2Cx->CR1, I2C_CR1_START_Pos) = 1;
 	}
 	else{
 		/* Disable the START condition generation */
-		I2Cx->CR1 &= ~(I2C_CR1_START);
+		BITBAND_PERIPH(I2Cx->CR1, I2C_CR1_START_Pos) = 0;
 	}
 
+	return MCAL_OK;
 }
 
 void I2C_Send_Address(I2C_Typedef *I2Cx, uint16_t Device_Address,I2C_Direction Direction){
@@ -599,22 +1127,22 @@ void I2C_Send_Address(I2C_Typedef *I2Cx, uint16_t Device_Address,I2C_Direction D
 void I2C_Stop(I2C_Typedef *I2Cx, Functional_State State){
 	if(State == Enable){
 		/* Generate a stop condition, Enable stop bit */
-		I2Cx->CR1 |= (I2C_CR1_STOP);
+		BITBAND_PERIPH(I2Cx->CR1, I2C_CR1_STOP_Pos) = 1;
 	}
 	else{
 		/* Disable the stop condition generation, Disable stop bit */
-		I2Cx->CR1 &= ~(I2C_CR1_STOP);
+		BITBAND_PERIPH(I2Cx->CR1, I2C_CR1_STOP_Pos) = 0;
 	}
 }
 
 void I2C_ACKConfig(I2C_Typedef *I2Cx, Functional_State State){
 	if(State == Enable){
 		/* Enable Automatic ACK */
-		I2Cx->CR1 |= (I2C_CR1_ACK);
+		BITBAND_PERIPH(I2Cx->CR1, I2C_CR1_ACK_Pos) = 1;
 	}
 	else{
 		/* Disable Automatic ACK */
-		I2Cx->CR1 &= ~(I2C_CR1_ACK);
+		BITBAND_PERIPH(I2Cx->CR1, I2C_CR1_ACK_Pos) = 0;
 	}
 }
 
@@ -622,15 +1150,198 @@ void I2C_ACKConfig(I2C_Typedef *I2Cx, Functional_State State){
 /* ================= IRQ Function Definitions ===================== */
 /* ================================================================ */
 
-void I2C1_EV_IRQHandler(void){
+/**===============================================================================================
+ * @FName			- I2C_Master_EV_Handler
+ * @Brief 			- Event state machine of the interrupt driven master transfers
+ * @Parameter [in] 	- index: I2C index (0 --> I2C1, 1 --> I2C2)
+ * @Parameter [in] 	- I2Cx: I2C instance of this index
+ * Note				- Reception follows RM0008 (26.3.3) for N = 1, N = 2 (POS) and N > 2 (BTF on the last 3 bytes)
+ */
+static void I2C_Master_EV_Handler(uint8_t index, I2C_Typedef *I2Cx){
+	I2C_Master_Handle_t *handle = &G_I2C_Master[index];
+	uint32_t SR1 = I2Cx->SR1;
+
+	switch(handle->phase){
+		case I2C_MASTER_WAIT_SB:
+			/* EV5: SB=1, cleared by reading SR1 register followed by writing DR register with Address. */
+			if(SR1 & I2C_SR1_SB){
+				if((handle->TxLength != 0) || (handle->RxLength == 0)){
+					I2C_Send_Address(I2Cx, handle->Device_Address, Transmitter);
+				}
+				else{
+					/* ACK the received bytes except the last one (N = 1 and N = 2 are handled at EV6) */
+					I2C_ACKConfig(I2Cx, Enable);
+					I2C_Send_Address(I2Cx, handle->Device_Address, Receiver);
+				}
+
+				/* Buffer interrupt may have been disabled by the write phase */
+				if(!handle->DMA_Mode)
+					I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+				handle->phase = I2C_MASTER_WAIT_ADDR;
+			}
+			break;
+
+		case I2C_MASTER_WAIT_ADDR:
+			/* EV6: ADDR=1, cleared by reading SR1 register followed by reading SR2. */
+			if((SR1 & I2C_SR1_ADDR) && handle->DMA_Mode){
+				/* DMA takes over once ADDR is cleared, the CPU is back at DMA TC */
+				I2Cx->CR2 &= ~(I2C_CR2_ITEVTEN);
+
+				if(handle->TxLength != 0){
+					(void)I2Cx->SR2;
+					handle->phase = I2C_MASTER_DMA_TX;
+				}
+				else if(handle->RxLength == 1){
+					/* LAST can not NACK a single byte, do it as EV6_1 */
+					I2C_ACKConfig(I2Cx, Disable);
+					(void)I2Cx->SR2;
+					I2C_Stop(I2Cx, Enable);
+					handle->phase = I2C_MASTER_DMA_RX;
+				}
+				else{
+					(void)I2Cx->SR2;
+					handle->phase = I2C_MASTER_DMA_RX;
+				}
+			}
+			else if(SR1 & I2C_SR1_ADDR){
+				if((handle->TxLength != 0) || (handle->RxLength == 0)){
+					(void)I2Cx->SR2;
+
+					if(handle->TxLength == 0){
+						/* Address probe only */
+						I2C_Stop(I2Cx, Enable);
+						I2C_Master_Complete(index, I2Cx, I2C_MASTER_DONE);
+					}
+					else{
+						handle->phase = I2C_MASTER_TX;
+					}
+				}
+				else if(handle->RxLength == 1){
+					/* EV6_1: NACK the only byte, clear ADDR then program STOP */
+					I2C_ACKConfig(I2Cx, Disable);
+					(void)I2Cx->SR2;
+					I2C_Stop(I2Cx, Enable);
+					handle->phase = I2C_MASTER_RX;
+				}
+				else if(handle->RxLength == 2){
+					/* NACK applies to the second byte (POS), wait for both bytes with BTF */
+					I2C_ACKConfig(I2Cx, Disable);
+					I2Cx->CR1 |= I2C_CR1_POS;
+					(void)I2Cx->SR2;
+					I2Cx->CR2 &= ~(I2C_CR2_ITBUFEN);
+					handle->phase = I2C_MASTER_RX;
+				}
+				else{
+					(void)I2Cx->SR2;
+					if(handle->RxLength == 3)
+						I2Cx->CR2 &= ~(I2C_CR2_ITBUFEN);
+					handle->phase = I2C_MASTER_RX;
+				}
+			}
+			break;
+
+		case I2C_MASTER_TX:
+			if((SR1 & I2C_SR1_TXE) && (I2Cx->CR2 & I2C_CR2_ITBUFEN)){
+				/* EV8: TxE=1, write the next byte */
+				I2Cx->DR = *handle->pTxData++;
+				handle->TxLength--;
+
+				/* Last byte written, wait for BTF */
+				if(handle->TxLength == 0)
+					I2Cx->CR2 &= ~(I2C_CR2_ITBUFEN);
+			}
+			else if(SR1 & I2C_SR1_BTF){
+				/* EV8_2: TxE=1, BTF=1, last byte on the bus */
+				if(handle->RxLength != 0){
+					/* Repeated start for the read phase, reading DR clears BTF meanwhile */
+					BITBAND_PERIPH(I2Cx->CR1, I2C_CR1_START_Pos) = 1;
+					(void)I2Cx->DR;
+					handle->phase = I2C_MASTER_WAIT_SB;
+				}
+				else{
+					I2C_Stop(I2Cx, Enable);
+					(void)I2Cx->DR;
+					I2C_Master_Complete(index, I2Cx, I2C_MASTER_DONE);
+				}
+			}
+			break;
+
+		case I2C_MASTER_RX:
+			if((SR1 & I2C_SR1_BTF) && ((handle->RxLength == 2) || (handle->RxLength == 3))){
+				if(handle->RxLength == 3){
+					/* EV7_2: data N-2 in DR, data N-1 in shift register, NACK data N */
+					I2C_ACKConfig(I2Cx, Disable);
+					*handle->pRxData++ = (uint8_t)I2Cx->DR;
+					handle->RxLength--;
+				}
+				else{
+					/* Data N-1 in DR, data N in shift register */
+					I2C_Stop(I2Cx, Enable);
+					*handle->pRxData++ = (uint8_t)I2Cx->DR;
+					*handle->pRxData++ = (uint8_t)I2Cx->DR;
+					handle->RxLength = 0;
+					I2C_Master_Complete(index, I2Cx, I2C_MASTER_DONE);
+				}
+			}
+			else if((SR1 & I2C_SR1_RXNE) && (I2Cx->CR2 & I2C_CR2_ITBUFEN)){
+				/* EV7: RxNE=1 cleared by reading DR register */
+				if(handle->RxLength == 1){
+					/* Single byte reception, STOP already programmed at EV6_1 */
+					*handle->pRxData++ = (uint8_t)I2Cx->DR;
+					handle->RxLength = 0;
+					I2C_Master_Complete(index, I2Cx, I2C_MASTER_DONE);
+				}
+				else if(handle->RxLength > 3){
+					*handle->pRxData++ = (uint8_t)I2Cx->DR;
+					handle->RxLength--;
+
+					/* The last 3 bytes are read on BTF */
+					if(handle->RxLength == 3)
+						I2Cx->CR2 &= ~(I2C_CR2_ITBUFEN);
+				}
+			}
+			break;
+
+		case I2C_MASTER_WAIT_BTF:
+			/* EV8_2 after DMA TX: TxE=1, BTF=1, program Stop, BTF cleared by reading DR meanwhile */
+			if(SR1 & I2C_SR1_BTF){
+				I2C_Stop(I2Cx, Enable);
+				(void)I2Cx->DR;
+				I2C_Master_Complete(index, I2Cx, I2C_MASTER_DONE);
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+/**===============================================================================================
+ * @FName			- I2C_EV_IRQ_Handler
+ * @Brief 			- Common event interrupt handling for both master and slave mode of the device
+ * @Parameter [in] 	- index: I2C index (0 --> I2C1, 1 --> I2C2)
+ * @Parameter [in] 	- I2Cx: I2C instance of this index
+ * Note				- NONE
+ */
+static void I2C_EV_IRQ_Handler(uint8_t index, I2C_Typedef *I2Cx){
 	//vuint32_t Dummy_Read = 0; // Volatile for compiler optimization
 
 	/* Interrupt handling for both master and slave mode of the device */
 	uint32_t Temp_1, Temp_2, Temp_3;
 
-	Temp_1 = (I2C1->CR2 & (I2C_CR2_ITEVTEN));	// Event interrupt enable
-	Temp_2 = (I2C1->CR2 & (I2C_CR2_ITBUFEN));	// Buffer interrupt enable
-	Temp_3 = (I2C1->SR1 & (I2C_SR1_STOPF));		// Stop detection (slave mode)
+	/* Master mode (interrupt driven transfer ongoing) */
+	if(G_I2C_Master[index].phase != I2C_MASTER_IDLE){
+		I2C_Master_EV_Handler(index, I2Cx);
+		return;
+	}
+
+	/* Slave mode needs the application callback */
+	if(G_I2C_Config[index].P_Slave_CallBack == NULL)
+		return;
+
+	Temp_1 = (I2Cx->CR2 & (I2C_CR2_ITEVTEN));	// Event interrupt enable
+	Temp_2 = (I2Cx->CR2 & (I2C_CR2_ITBUFEN));	// Buffer interrupt enable
+	Temp_3 = (I2Cx->SR1 & (I2C_SR1_STOPF));		// Stop detection (slave mode)
 
 	/* Handle Stop Condition Event */
 	if(Temp_1 && Temp_3){
@@ -638,28 +1349,32 @@ void I2C1_EV_IRQHandler(void){
 		 * i have already read SR1 in Temp_3
 		 * then next statement i write to CR1
 		 */
-		I2C1->CR1 |= 0x0000;
-		G_I2C_Config[I2C1_Index].P_Slave_CallBack(I2C_EV_STOP);
+		I2Cx->CR1 |= 0x0000;
+
+		if(G_I2C_Retime_Pending[index])
+			I2C_Retime(index, I2Cx);
+
+		G_I2C_Config[index].P_Slave_CallBack(I2C_EV_STOP);
 	}
 
 	/* =============================================================================== */
 
 	/* Handle Received address matched. */
-	Temp_3 = (I2C1->SR1 & (I2C_SR1_ADDR));		//ADDR
+	Temp_3 = (I2Cx->SR1 & (I2C_SR1_ADDR));		//ADDR
 	if(Temp_1 && Temp_3){
 		/* clear ADDR flag
 		 * In slave mode, it is recommended to perform the complete clearing sequence (READ SR1 then READ SR2) after ADDR is set.
 		 */
-		//Dummy_Read  = I2C1->SR1;
-		//Dummy_Read  = I2C1->SR2;
+		//Dummy_Read  = I2Cx->SR1;
+		//Dummy_Read  = I2Cx->SR2;
 
 		/* Check master mode or slave mode */
-		if(I2C1->SR2 & (I2C_SR2_MSL)){
+		if(I2Cx->SR2 & (I2C_SR2_MSL)){
 			/* Master mode (Using polling mechanism not interrupt) */
 		}
 		else{
 			/* Slave mode */
-			G_I2C_Config[I2C1_Index].P_Slave_CallBack(I2C_EV_ADD_MATCHED);
+			G_I2C_Config[index].P_Slave_CallBack(I2C_EV_ADD_MATCHED);
 		}
 
 	}
@@ -667,17 +1382,17 @@ void I2C1_EV_IRQHandler(void){
 	/* =============================================================================== */
 
 	/* Handle TxE: Data register empty (Master request data from slave)--> slave_transmitter */
-	Temp_3 = (I2C1->SR1 & (I2C_SR1_TXE));		// TXE
+	Temp_3 = (I2Cx->SR1 & (I2C_SR1_TXE));		// TXE
 	if(Temp_1 && Temp_2 && Temp_3){				// In case TXE=1, ITEVTEN=1, ITBUFEN=1
 		/* Check master mode or slave mode */
-		if(I2C1->SR2 & (I2C_SR2_MSL)){
+		if(I2Cx->SR2 & (I2C_SR2_MSL)){
 			/* Master mode (Using polling mechanism not interrupt) */
 		}
 		else{
 			/* Slave mode */
 			/* Check if slave in transmit mode */
-			if(I2C1->SR2 & (I2C_SR2_TRA)){		//TRA: Transmitter/receiver: 1: Data bytes transmitted
-				G_I2C_Config[I2C1_Index].P_Slave_CallBack(I2C_EV_DATA_REQ);
+			if(I2Cx->SR2 & (I2C_SR2_TRA)){		//TRA: Transmitter/receiver: 1: Data bytes transmitted
+				G_I2C_Config[index].P_Slave_CallBack(I2C_EV_DATA_REQ);
 			}
 		}
 	}
@@ -685,31 +1400,66 @@ void I2C1_EV_IRQHandler(void){
 	/* =============================================================================== */
 
 	/* Handle RxNE: Data register not empty (slave receive data)-->slave_Receiver */
-	Temp_3 = (I2C1->SR1 & (I2C_SR1_RXNE));		// RXNE
+	Temp_3 = (I2Cx->SR1 & (I2C_SR1_RXNE));		// RXNE
 	if(Temp_1 && Temp_2 && Temp_3){				// In case RXNE=1, ITEVTEN=1, ITBUFEN=1
 		/* Check master mode or slave mode */
-		if(I2C1->SR2 & (I2C_SR2_MSL)){
+		if(I2Cx->SR2 & (I2C_SR2_MSL)){
 			/* Master mode (Using polling mechanism not interrupt) */
 		}
 		else{
 			/* Slave mode */
-			if(!(I2C1->SR2 & (I2C_SR2_TRA))){		//TRA: Transmitter/receiver: 0: Data bytes received
-				G_I2C_Config[I2C1_Index].P_Slave_CallBack(I2C_EV_DATA_RCV);
+			if(!(I2Cx->SR2 & (I2C_SR2_TRA))){		//TRA: Transmitter/receiver: 0: Data bytes received
+				G_I2C_Config[index].P_Slave_CallBack(I2C_EV_DATA_RCV);
 			}
 		}
 	}
 }
 
-void I2C1_ER_IRQHandler(void){
+/**===============================================================================================
+ * @FName			- I2C_ER_IRQ_Handler
+ * @Brief 			- Common error interrupt handling
+ * @Parameter [in] 	- index: I2C index (0 --> I2C1, 1 --> I2C2)
+ * @Parameter [in] 	- I2Cx: I2C instance of this index
+ * Note				- Error flags are cleared by writing 0, in slave mode AF after the last byte sent is normal
+ */
+static void I2C_ER_IRQ_Handler(uint8_t index, I2C_Typedef *I2Cx){
+	uint32_t SR1 = I2Cx->SR1;
+
+	/* Clear all the error flags of this event */
+	I2Cx->SR1 = ~(SR1 & (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR)) & 0xFFFF;
 
+	if(G_I2C_Master[index].phase == I2C_MASTER_IDLE)
+		return;
+
+	if(SR1 & I2C_SR1_ARLO){
+		/* The bus belongs to the other master, no stop */
+		I2C_Master_Complete(index, I2Cx, I2C_MASTER_ARLO);
+	}
+	else if(SR1 & I2C_SR1_BERR){
+		I2C_Stop(I2Cx, Enable);
+		I2C_Master_Complete(index, I2Cx, I2C_MASTER_BERR);
+	}
+	else if(SR1 & I2C_SR1_AF){
+		/* Address or data NACKed by the slave */
+		I2C_Stop(I2Cx, Enable);
+		I2C_Master_Complete(index, I2Cx, I2C_MASTER_NACK);
+	}
 }
 
-void I2C2_EV_IRQHandler(void){
+void I2C1_EV_IRQHandler(void){
+	I2C_EV_IRQ_Handler(I2C1_Index, I2C1);
+}
+
+void I2C1_ER_IRQHandler(void){
+	I2C_ER_IRQ_Handler(I2C1_Index, I2C1);
+}
 
+void I2C2_EV_IRQHandler(void){
+	I2C_EV_IRQ_Handler(I2C2_Index, I2C2);
 }
 
 void I2C2_ER_IRQHandler(void){
-
+	I2C_ER_IRQ_Handler(I2C2_Index, I2C2);
 }
 
 /*******************************************************/
@@ -44,6 +44,23 @@
 #define NVIC_ICER1									(*(volatile uint32_t*)(NVIC_BASE_ADDRESS + 0x84))
 #define NVIC_ICER2									(*(volatile uint32_t*)(NVIC_BASE_ADDRESS + 0x88))
 
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Peripheral: DWT (cycle counter)                     */
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+#define DWT_BASE_ADDRESS							0xE0001000UL
+#define DWT_CTRL									(*(volatile uint32_t*)(DWT_BASE_ADDRESS + 0x00))
+#define DWT_CYCCNT									(*(volatile uint32_t*)(DWT_BASE_ADDRESS + 0x04))
+
+#define COREDEBUG_DEMCR								(*(volatile uint32_t*)(0xE000EDFCUL))
+
+/* DEMCR Bit 24 TRCENA must be set before DWT_CTRL Bit 0 CYCCNTENA */
+#define DWT_CYCCNT_ENABLE()							do{ COREDEBUG_DEMCR |= 1 << 24; DWT_CYCCNT = 0; DWT_CTRL |= 1 << 0; }while(0)
+
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Peripheral: SysTick                                 */
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+#define SYSTICK_BASE_ADDRESS						0xE000E010UL
+
 /******** Base addresses for AHB Peripherals ***********/
 
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
@@ -52,6 +69,23 @@
 #define RCC_BASE_ADDRESS							0x40021000UL
 //#define RCC_BASE_ADDRESS							(PERIPHERALS_BASE_ADDRESS + 0x21000)
 
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Peripheral: FLASH memory interface                  */
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+#define FLASH_INTERFACE_BASE_ADDRESS				0x40022000UL
+
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Peripheral: DMA                                     */
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+#define DMA1_BASE_ADDRESS							0x40020000UL
+#define DMA1_Channel1_BASE_ADDRESS					(DMA1_BASE_ADDRESS + 0x08)
+#define DMA1_Channel2_BASE_ADDRESS					(DMA1_BASE_ADDRESS + 0x1C)
+#define DMA1_Channel3_BASE_ADDRESS					(DMA1_BASE_ADDRESS + 0x30)
+#define DMA1_Channel4_BASE_ADDRESS					(DMA1_BASE_ADDRESS + 0x44)
+#define DMA1_Channel5_BASE_ADDRESS					(DMA1_BASE_ADDRESS + 0x58)
+#define DMA1_Channel6_BASE_ADDRESS					(DMA1_BASE_ADDRESS + 0x6C)
+#define DMA1_Channel7_BASE_ADDRESS					(DMA1_BASE_ADDRESS + 0x80)
+
 /******** Base addresses for APB1 Peripherals **********/
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
 /* Peripheral: USART                                   */
@@ -125,6 +159,21 @@ typedef struct{
 	volatile uint32_t CSR;
 } RCC_TypeDef;
 
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Peripheral register: FLASH                          */
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+typedef struct{
+	volatile uint32_t ACR;
+	volatile uint32_t KEYR;
+	volatile uint32_t OPTKEYR;
+	volatile uint32_t SR;
+	volatile uint32_t CR;
+	volatile uint32_t AR;
+	volatile uint32_t RESERVED;
+	volatile uint32_t OBR;
+	volatile uint32_t WRPR;
+} FLASH_TypeDef;
+
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
 /* Peripheral register: GPIO                           */
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
@@ -203,11 +252,38 @@ typedef struct{
 	volatile uint32_t TRISE;
 } I2C_Typedef;
 
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Peripheral register: DMA                            */
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+typedef struct{
+	volatile uint32_t ISR;
+	volatile uint32_t IFCR;
+} DMA_TypeDef;
+
+typedef struct{
+	volatile uint32_t CCR;
+	volatile uint32_t CNDTR;
+	volatile uint32_t CPAR;
+	volatile uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Peripheral register: SysTick                        */
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+typedef struct{
+	volatile uint32_t CTRL;
+	volatile uint32_t LOAD;		/* 24-bit reload value */
+	volatile uint32_t VAL;
+	volatile uint32_t CALIB;
+} SysTick_TypeDef;
+
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
 /* Peripheral Instants:                                */
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
 #define RCC											((RCC_TypeDef *)RCC_BASE_ADDRESS)
 
+#define FLASH										((FLASH_TypeDef *)FLASH_INTERFACE_BASE_ADDRESS)
+
 #define GPIOA										((GPIO_TypeDef *)GPIOA_BASE_ADDRESS)
 #define GPIOB										((GPIO_TypeDef *)GPIOB_BASE_ADDRESS)
 #define GPIOC										((GPIO_TypeDef *)GPIOC_BASE_ADDRESS)
@@ -228,41 +304,73 @@ typedef struct{
 #define I2C1										((I2C_Typedef *)I2C1_BASE_ADDRESS)
 #define I2C2										((I2C_Typedef *)I2C2_BASE_ADDRESS)
 
+#define DMA1										((DMA_TypeDef *)DMA1_BASE_ADDRESS)
+#define DMA1_Channel1								((DMA_Channel_TypeDef *)DMA1_Channel1_BASE_ADDRESS)
+#define DMA1_Channel2								((DMA_Channel_TypeDef *)DMA1_Channel2_BASE_ADDRESS)
+#define DMA1_Channel3								((DMA_Channel_TypeDef *)DMA1_Channel3_BASE_ADDRESS)
+#define DMA1_Channel4								((DMA_Channel_TypeDef *)DMA1_Channel4_BASE_ADDRESS)
+#define DMA1_Channel5								((DMA_Channel_TypeDef *)DMA1_Channel5_BASE_ADDRESS)
+#define DMA1_Channel6								((DMA_Channel_TypeDef *)DMA1_Channel6_BASE_ADDRESS)
+#define DMA1_Channel7								((DMA_Channel_TypeDef *)DMA1_Channel7_BASE_ADDRESS)
+
+#define SysTick										((SysTick_TypeDef *)SYSTICK_BASE_ADDRESS)
+
+/*******************************************************/
+
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Bit-Band Macros:                                    */
+/*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/**
+ * Each bit of the first 1MB of SRAM / peripherals has a word alias: one store writes one bit,
+ * no read-modify-write (an ISR can not be undone, hardware cleared bits of the register are kept).
+ * e.g. BITBAND_PERIPH(I2C1->CR1, I2C_CR1_START_Pos) = 1;   if(BITBAND_SRAM(flags, 3)) ...
+ * Not for registers with rc_w0 / rc_w1 flags (the bus still does a read-modify-write of the word).
+ */
+#define SRAM_BITBAND_BASE_ADDRESS					0x22000000UL
+#define PERIPHERALS_BITBAND_BASE_ADDRESS			0x42000000UL
+
+#define BITBAND_PERIPH(REG, BIT)					(*(volatile uint32_t *)(PERIPHERALS_BITBAND_BASE_ADDRESS + \
+													(((uint32_t)&(REG) - PERIPHERALS_BASE_ADDRESS) << 5) + ((uint32_t)(BIT) << 2)))
+#define BITBAND_SRAM(VAR, BIT)						(*(volatile uint32_t *)(SRAM_BITBAND_BASE_ADDRESS + \
+													(((uint32_t)&(VAR) - SRAM_BASE_ADDRESS) << 5) + ((uint32_t)(BIT) << 2)))
+
 /*******************************************************/
 
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
 /* clock enable Macros:                                */
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
-#define RCC_AFIO_CLK_EN()							(RCC->APB2ENR |= 1 << 0)
+#define RCC_AFIO_CLK_EN()							(BITBAND_PERIPH(RCC->APB2ENR, 0) = 1)
+
+#define RCC_GPIOA_CLK_EN()							(BITBAND_PERIPH(RCC->APB2ENR, 2) = 1)
+#define RCC_GPIOB_CLK_EN()							(BITBAND_PERIPH(RCC->APB2ENR, 3) = 1)
+#define RCC_GPIOC_CLK_EN()							(BITBAND_PERIPH(RCC->APB2ENR, 4) = 1)
+#define RCC_GPIOD_CLK_EN()							(BITBAND_PERIPH(RCC->APB2ENR, 5) = 1)
+#define RCC_GPIOE_CLK_EN()							(BITBAND_PERIPH(RCC->APB2ENR, 6) = 1)
 
-#define RCC_GPIOA_CLK_EN()							(RCC->APB2ENR |= 1 << 2)
-#define RCC_GPIOB_CLK_EN()							(RCC->APB2ENR |= 1 << 3)
-#define RCC_GPIOC_CLK_EN()							(RCC->APB2ENR |= 1 << 4)
-#define RCC_GPIOD_CLK_EN()							(RCC->APB2ENR |= 1 << 5)
-#define RCC_GPIOE_CLK_EN()							(RCC->APB2ENR |= 1 << 6)
+#define RCC_USART1_CLK_EN()							(BITBAND_PERIPH(RCC->APB2ENR, 14) = 1)
+#define RCC_USART2_CLK_EN()							(BITBAND_PERIPH(RCC->APB1ENR, 17) = 1)
+#define RCC_USART3_CLK_EN()							(BITBAND_PERIPH(RCC->APB1ENR, 18) = 1)
 
-#define RCC_USART1_CLK_EN()							(RCC->APB2ENR |= 1 << 14)
-#define RCC_USART2_CLK_EN()							(RCC->APB1ENR |= 1 << 17)
-#define RCC_USART3_CLK_EN()							(RCC->APB1ENR |= 1 << 18)
+#define RCC_SPI1_CLK_EN()							(BITBAND_PERIPH(RCC->APB2ENR, 12) = 1)
+#define RCC_SPI2_CLK_EN()							(BITBAND_PERIPH(RCC->APB1ENR, 14) = 1)
 
-#define RCC_SPI1_CLK_EN()							(RCC->APB2ENR |= 1 << 12)
-#define RCC_SPI2_CLK_EN()							(RCC->APB1ENR |= 1 << 14)
+#define RCC_I2C1_CLK_EN()							(BITBAND_PERIPH(RCC->APB1ENR, 21) = 1)
+#define RCC_I2C2_CLK_EN()							(BITBAND_PERIPH(RCC->APB1ENR, 22) = 1)
 
-#define RCC_I2C1_CLK_EN()							(RCC->APB1ENR |= 1 << 21)
-#define RCC_I2C2_CLK_EN()							(RCC->APB1ENR |= 1 << 22)
+#define RCC_DMA1_CLK_EN()							(BITBAND_PERIPH(RCC->AHBENR, 0) = 1)
 
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
-/* clock disable Macros:                               */
+/* clock disable Macros: (reset pulse)                 */
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
-#define RCC_USART1_CLK_RST()						(RCC->APB2RSTR |= 1 << 14)
-#define RCC_USART2_CLK_RST()						(RCC->APB1RSTR |= 1 << 17)
-#define RCC_USART3_CLK_RST()						(RCC->APB1RSTR |= 1 << 18)
+#define RCC_USART1_CLK_RST()						(BITBAND_PERIPH(RCC->APB2RSTR, 14) = 1, BITBAND_PERIPH(RCC->APB2RSTR, 14) = 0)
+#define RCC_USART2_CLK_RST()						(BITBAND_PERIPH(RCC->APB1RSTR, 17) = 1, BITBAND_PERIPH(RCC->APB1RSTR, 17) = 0)
+#define RCC_USART3_CLK_RST()						(BITBAND_PERIPH(RCC->APB1RSTR, 18) = 1, BITBAND_PERIPH(RCC->APB1RSTR, 18) = 0)
 
-#define RCC_SPI1_CLK_RST()							(RCC->APB2RSTR |= 1 << 12)
-#define RCC_SPI2_CLK_RST()							(RCC->APB1RSTR |= 1 << 14)
+#define RCC_SPI1_CLK_RST()							(BITBAND_PERIPH(RCC->APB2RSTR, 12) = 1, BITBAND_PERIPH(RCC->APB2RSTR, 12) = 0)
+#define RCC_SPI2_CLK_RST()							(BITBAND_PERIPH(RCC->APB1RSTR, 14) = 1, BITBAND_PERIPH(RCC->APB1RSTR, 14) = 0)
 
-#define RCC_I2C1_CLK_RST()							(RCC->APB1RSTR |= 1 << 21)
-#define RCC_I2C2_CLK_RST()							(RCC->APB1RSTR |= 1 << 22)
+#define RCC_I2C1_CLK_RST()							(BITBAND_PERIPH(RCC->APB1RSTR, 21) = 1, BITBAND_PERIPH(RCC->APB1RSTR, 21) = 0)
+#define RCC_I2C2_CLK_RST()							(BITBAND_PERIPH(RCC->APB1RSTR, 22) = 1, BITBAND_PERIPH(RCC->APB1RSTR, 22) = 0)
 
 /*******************************************************/
 
@@ -302,6 +410,15 @@ typedef struct{
 #define I2C2_EV_IRQ									33
 #define I2C2_ER_IRQ									34
 
+/* DMA1 */
+#define DMA1_Channel1_IRQ							11
+#define DMA1_Channel2_IRQ							12
+#define DMA1_Channel3_IRQ							13
+#define DMA1_Channel4_IRQ							14
+#define DMA1_Channel5_IRQ							15
+#define DMA1_Channel6_IRQ							16
+#define DMA1_Channel7_IRQ							17
+
 /*******************************************************/
 
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
@@ -331,34 +448,53 @@ typedef struct{
 #define NVIC_IRQ33_I2C2_EV_IRQ_EN()					(NVIC_ISER1 |= 1 << (I2C2_EV_IRQ - 32))		// I2C2 event interrupt
 #define NVIC_IRQ34_I2C2_ER_IRQ_EN()					(NVIC_ISER1 |= 1 << (I2C2_ER_IRQ - 32))		// I2C2 error interrupt
 
+/* DMA1 */
+#define NVIC_IRQ11_DMA1_CH1_ENABLE()				(NVIC_ISER0 |= 1 << (DMA1_Channel1_IRQ))
+#define NVIC_IRQ12_DMA1_CH2_ENABLE()				(NVIC_ISER0 |= 1 << (DMA1_Channel2_IRQ))
+#define NVIC_IRQ13_DMA1_CH3_ENABLE()				(NVIC_ISER0 |= 1 << (DMA1_Channel3_IRQ))
+#define NVIC_IRQ14_DMA1_CH4_ENABLE()				(NVIC_ISER0 |= 1 << (DMA1_Channel4_IRQ))
+#define NVIC_IRQ15_DMA1_CH5_ENABLE()				(NVIC_ISER0 |= 1 << (DMA1_Channel5_IRQ))
+#define NVIC_IRQ16_DMA1_CH6_ENABLE()				(NVIC_ISER0 |= 1 << (DMA1_Channel6_IRQ))
+#define NVIC_IRQ17_DMA1_CH7_ENABLE()				(NVIC_ISER0 |= 1 << (DMA1_Channel7_IRQ))
+
 /*******************************************************/
 
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
 /* NVIC IRQ Disable Macros:                            */
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* ICER reads back every enabled IRQ and writing 1 disables it: plain store only, never |= */
 /* EXTI */
-#define NVIC_IRQ6_EXTI0_DISABLE()					(NVIC_ICER0 |= 1 << 6)
-#define NVIC_IRQ7_EXTI1_DISABLE()					(NVIC_ICER0 |= 1 << 7)
-#define NVIC_IRQ8_EXTI2_DISABLE()					(NVIC_ICER0 |= 1 << 8)
-#define NVIC_IRQ9_EXTI3_DISABLE()					(NVIC_ICER0 |= 1 << 9)
-#define NVIC_IRQ10_EXTI4_DISABLE()					(NVIC_ICER0 |= 1 << 10)
-#define NVIC_IRQ23_EXTI5_9_DISABLE()				(NVIC_ICER0 |= 1 << 23)
-#define NVIC_IRQ40_EXTI10_15_DISABLE()				(NVIC_ICER1 |= 1 << 8)  /* 40 - 32 = 8 */
+#define NVIC_IRQ6_EXTI0_DISABLE()					(NVIC_ICER0 = 1UL << 6)
+#define NVIC_IRQ7_EXTI1_DISABLE()					(NVIC_ICER0 = 1UL << 7)
+#define NVIC_IRQ8_EXTI2_DISABLE()					(NVIC_ICER0 = 1UL << 8)
+#define NVIC_IRQ9_EXTI3_DISABLE()					(NVIC_ICER0 = 1UL << 9)
+#define NVIC_IRQ10_EXTI4_DISABLE()					(NVIC_ICER0 = 1UL << 10)
+#define NVIC_IRQ23_EXTI5_9_DISABLE()				(NVIC_ICER0 = 1UL << 23)
+#define NVIC_IRQ40_EXTI10_15_DISABLE()				(NVIC_ICER1 = 1UL << 8)  /* 40 - 32 = 8 */
 
 /* USART */
-#define NVIC_IRQ37_USART1_DISABLE()					(NVIC_ICER1 |= 1 << 5) /* 37 - 32 = 5 */
-#define NVIC_IRQ38_USART2_DISABLE()					(NVIC_ICER1 |= 1 << 6) /* 38 - 32 = 6 */
-#define NVIC_IRQ39_USART3_DISABLE()					(NVIC_ICER1 |= 1 << 7) /* 39 - 32 = 7 */
+#define NVIC_IRQ37_USART1_DISABLE()					(NVIC_ICER1 = 1UL << 5) /* 37 - 32 = 5 */
+#define NVIC_IRQ38_USART2_DISABLE()					(NVIC_ICER1 = 1UL << 6) /* 38 - 32 = 6 */
+#define NVIC_IRQ39_USART3_DISABLE()					(NVIC_ICER1 = 1UL << 7) /* 39 - 32 = 7 */
 
 /* SPI */
-#define NVIC_IRQ35_SPI1_DISABLE()					(NVIC_ICER1 |= 1 << (SPI1_IRQ - 32))  /* 35 - 32 */
-#define NVIC_IRQ36_SPI2_DISABLE()					(NVIC_ICER1 |= 1 << (SPI2_IRQ - 32))  /* 36 - 32 */
+#define NVIC_IRQ35_SPI1_DISABLE()					(NVIC_ICER1 = 1UL << (SPI1_IRQ - 32))  /* 35 - 32 */
+#define NVIC_IRQ36_SPI2_DISABLE()					(NVIC_ICER1 = 1UL << (SPI2_IRQ - 32))  /* 36 - 32 */
 
 /* I2C */
-#define NVIC_IRQ31_I2C1_EV_IRQ_DISABLE()					(NVIC_ICER0 |= 1 << (I2C1_EV_IRQ))			// I2C1 event interrupt
-#define NVIC_IRQ32_I2C1_ER_IRQ_DISABLE()					(NVIC_ICER1 |= 1 << (I2C1_ER_IRQ - 32))		// I2C1 error interrupt
-#define NVIC_IRQ33_I2C2_EV_IRQ_DISABLE()					(NVIC_ICER1 |= 1 << (I2C2_EV_IRQ - 32))		// I2C2 event interrupt
-#define NVIC_IRQ34_I2C2_ER_IRQ_DISABLE()					(NVIC_ICER1 |= 1 << (I2C2_ER_IRQ - 32))		// I2C2 error interrupt
+#define NVIC_IRQ31_I2C1_EV_IRQ_DISABLE()					(NVIC_ICER0 = 1UL << (I2C1_EV_IRQ))			// I2C1 event interrupt
+#define NVIC_IRQ32_I2C1_ER_IRQ_DISABLE()					(NVIC_ICER1 = 1UL << (I2C1_ER_IRQ - 32))		// I2C1 error interrupt
+#define NVIC_IRQ33_I2C2_EV_IRQ_DISABLE()					(NVIC_ICER1 = 1UL << (I2C2_EV_IRQ - 32))		// I2C2 event interrupt
+#define NVIC_IRQ34_I2C2_ER_IRQ_DISABLE()					(NVIC_ICER1 = 1UL << (I2C2_ER_IRQ - 32))		// I2C2 error interrupt
+
+/* DMA1 */
+#define NVIC_IRQ11_DMA1_CH1_DISABLE()				(NVIC_ICER0 = 1UL << (DMA1_Channel1_IRQ))
+#define NVIC_IRQ12_DMA1_CH2_DISABLE()				(NVIC_ICER0 = 1UL << (DMA1_Channel2_IRQ))
+#define NVIC_IRQ13_DMA1_CH3_DISABLE()				(NVIC_ICER0 = 1UL << (DMA1_Channel3_IRQ))
+#define NVIC_IRQ14_DMA1_CH4_DISABLE()				(NVIC_ICER0 = 1UL << (DMA1_Channel4_IRQ))
+#define NVIC_IRQ15_DMA1_CH5_DISABLE()				(NVIC_ICER0 = 1UL << (DMA1_Channel5_IRQ))
+#define NVIC_IRQ16_DMA1_CH6_DISABLE()				(NVIC_ICER0 = 1UL << (DMA1_Channel6_IRQ))
+#define NVIC_IRQ17_DMA1_CH7_DISABLE()				(NVIC_ICER0 = 1UL << (DMA1_Channel7_IRQ))
 
 /*******************************************************/
 
@@ -551,6 +687,13 @@ typedef struct{
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
 /* Generic Macros:                                     */
 /*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*/
+/* Status returned by the non-void driver APIs */
+typedef enum{
+	MCAL_OK,
+	MCAL_ERROR,
+	MCAL_BUSY,
+	MCAL_TIMEOUT
+} MCAL_Status_t;
 
 /*******************************************************/
 
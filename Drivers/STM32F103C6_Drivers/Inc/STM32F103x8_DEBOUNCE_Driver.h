@@ -0,0 +1,116 @@
+/*
+ * STM32F103x8_DEBOUNCE_Driver.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ */
+
+#ifndef INC_STM32F103X8_DEBOUNCE_DRIVER_H_
+#define INC_STM32F103X8_DEBOUNCE_DRIVER_H_
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include "STM32F103x8.h"
+#include "STM32F103x8_GPIO_Driver.h"
+#include "STM32F103x8_RCC_Driver.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/******** User type definitions (structures) ***********/
+/*******************************************************/
+/* Configuration Structure */
+typedef struct{
+	/**
+	 * @Tick_ms
+	 * Sampling period in ms, a pin must read the same level on 4 ticks in a row to change state.
+	 * With @ref Debounce_TickSource_SysTick the reload must fit 24 bits (Tick_ms <= 233 at 72 MHz).
+	 */
+	uint8_t Tick_ms;
+
+	/**
+	 * @LongPress_ms
+	 * Time a pin must stay pressed before a long press event is queued (0: no long press events).
+	 */
+	uint16_t LongPress_ms;
+
+	/**
+	 * @TickSource
+	 * Specifies what calls MCAL_Debounce_Tick().
+	 * this parameter must be set based on @ref Debounce_TickSource_define.
+	 */
+	uint8_t TickSource;
+} Debounce_Config_t;
+
+typedef struct{
+	/**
+	 * @GPIOx
+	 * Port of the pin that changed state.
+	 */
+	GPIO_TypeDef *GPIOx;
+
+	/**
+	 * @pin
+	 * Pin that changed state, one of @ref GPIO_PIN_define.
+	 */
+	uint16_t pin;
+
+	/**
+	 * @type
+	 * Kind of event, one of @ref Debounce_Event_define.
+	 */
+	uint8_t type;
+} Debounce_Event_t;
+
+/*******************************************************/
+
+/*******************************************************/
+/********* Macros Configuration References *************/
+/*******************************************************/
+/* Number of queued events, must be a power of 2 (one slot is kept empty) */
+#ifndef DEBOUNCE_QUEUE_SIZE
+#define DEBOUNCE_QUEUE_SIZE								16
+#endif
+
+/* Number of ports that can be sampled at once */
+#ifndef DEBOUNCE_MAX_PORTS
+#define DEBOUNCE_MAX_PORTS								4
+#endif
+
+/*
+ * 1: the driver defines SysTick_Handler (needed by Debounce_TickSource_SysTick)
+ * 0: SysTick_Handler is left to the application, only Debounce_TickSource_External can be used
+ */
+#ifndef DEBOUNCE_USE_SYSTICK
+#define DEBOUNCE_USE_SYSTICK							1
+#endif
+
+/* @ref Debounce_TickSource_define */
+#define Debounce_TickSource_SysTick						0	/* The driver owns SysTick and its handler (DEBOUNCE_USE_SYSTICK = 1) */
+#define Debounce_TickSource_External					1	/* The application calls MCAL_Debounce_Tick() from a timer ISR */
+
+/* @ref Debounce_Event_define */
+#define Debounce_Event_Press							0
+#define Debounce_Event_Release							1
+#define Debounce_Event_LongPress						2	/* Followed by a release event when the pin is let go */
+
+/*******************************************************/
+
+/*******************************************************/
+/***** APIs Supported by "MCAL DEBOUNCE DRIVER" ********/
+/*******************************************************/
+
+MCAL_Status_t MCAL_Debounce_Init(const Debounce_Config_t *pDebounce_Config);
+void MCAL_Debounce_DeInit(void);
+
+MCAL_Status_t MCAL_Debounce_AddPort(GPIO_TypeDef *GPIOx, uint16_t PinMask, uint16_t ActiveLowMask);
+
+void MCAL_Debounce_Tick(void);
+
+uint8_t MCAL_Debounce_GetEvent(Debounce_Event_t *pEvent);
+uint16_t MCAL_Debounce_GetState(GPIO_TypeDef *GPIOx);
+
+/*******************************************************/
+
+#endif /* INC_STM32F103X8_DEBOUNCE_DRIVER_H_ */
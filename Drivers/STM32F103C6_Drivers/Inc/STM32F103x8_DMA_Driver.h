@@ -0,0 +1,189 @@
+/*
+ * STM32F103x8_DMA_Driver.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ */
+
+#ifndef INC_STM32F103X8_DMA_DRIVER_H_
+#define INC_STM32F103X8_DMA_DRIVER_H_
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include "STM32F103x8.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/******** User type definitions (structures) ***********/
+/*******************************************************/
+struct S_DMA_IRQ_SRC{
+	uint8_t TC      :1; /* Transfer Complete Interrupt. */
+	uint8_t TE      :1; /* Transfer Error Interrupt. */
+	uint8_t HT      :1; /* Half Transfer Interrupt. */
+	uint8_t Reseved :5;
+};
+
+typedef struct{
+	/**
+	 * @direction
+	 * Specifies the data transfer direction.
+	 * this parameter must be set based on @ref DMA_Direction_define.
+	 */
+	uint32_t direction;
+
+	/**
+	 * @priority
+	 * Specifies the software priority of the channel.
+	 * this parameter must be set based on @ref DMA_Priority_define.
+	 */
+	uint32_t priority;
+
+	/**
+	 * @periphSize
+	 * Specifies the peripheral data width.
+	 * this parameter must be set based on @ref DMA_PeriphSize_define.
+	 */
+	uint32_t periphSize;
+
+	/**
+	 * @memSize
+	 * Specifies the memory data width.
+	 * this parameter must be set based on @ref DMA_MemSize_define.
+	 */
+	uint32_t memSize;
+
+	/**
+	 * @periphInc
+	 * Specifies whether the peripheral address is incremented after each transfer.
+	 * this parameter must be set based on @ref DMA_PeriphInc_define.
+	 */
+	uint32_t periphInc;
+
+	/**
+	 * @memInc
+	 * Specifies whether the memory address is incremented after each transfer.
+	 * this parameter must be set based on @ref DMA_MemInc_define.
+	 */
+	uint32_t memInc;
+
+	/**
+	 * @mode
+	 * Specifies normal (one shot) or circular mode.
+	 * this parameter must be set based on @ref DMA_Mode_define.
+	 */
+	uint32_t mode;
+
+	/**
+	 * @IRQ_EN
+	 * Enable or Disable channel interrupts.
+	 * this parameter must be set based on @ref DMA_IRQ_define.
+	 */
+	uint32_t IRQ_EN;
+
+	/**
+	 * @P_IRQ_CallBack
+	 * Set the C Function() which will be called once the IRQ Happen.
+	 */
+	void (* P_IRQ_CallBack)(struct S_DMA_IRQ_SRC irq_src);
+} DMA_Config_t;
+
+/*******************************************************/
+
+/*******************************************************/
+/********* Macros Configuration References *************/
+/*******************************************************/
+/* @ref DMA_Direction_define */
+#define DMA_Direction_PeriphToMem				((uint32_t)(0 << 4))		/* Bit 4 DIR: Read from peripheral */
+#define DMA_Direction_MemToPeriph				((uint32_t)(1 << 4))		/* Bit 4 DIR: Read from memory */
+#define DMA_Direction_MemToMem					((uint32_t)(1 << 14))		/* Bit 14 MEM2MEM: CPAR is the source, CMAR the destination, no request needed */
+
+/* @ref DMA_Priority_define */
+#define DMA_Priority_Low						((uint32_t)(0 << 12))		/* Bits 13:12 PL[1:0] */
+#define DMA_Priority_Medium						((uint32_t)(1 << 12))
+#define DMA_Priority_High						((uint32_t)(2 << 12))
+#define DMA_Priority_VeryHigh					((uint32_t)(3 << 12))
+
+/* @ref DMA_PeriphSize_define */
+#define DMA_PeriphSize_8bits					((uint32_t)(0 << 8))		/* Bits 9:8 PSIZE[1:0] */
+#define DMA_PeriphSize_16bits					((uint32_t)(1 << 8))
+#define DMA_PeriphSize_32bits					((uint32_t)(2 << 8))
+
+/* @ref DMA_MemSize_define */
+#define DMA_MemSize_8bits						((uint32_t)(0 << 10))		/* Bits 11:10 MSIZE[1:0] */
+#define DMA_MemSize_16bits						((uint32_t)(1 << 10))
+#define DMA_MemSize_32bits						((uint32_t)(2 << 10))
+
+/* @ref DMA_PeriphInc_define */
+#define DMA_PeriphInc_Disable					((uint32_t)(0 << 6))		/* Bit 6 PINC */
+#define DMA_PeriphInc_Enable					((uint32_t)(1 << 6))
+
+/* @ref DMA_MemInc_define */
+#define DMA_MemInc_Disable						((uint32_t)(0 << 7))		/* Bit 7 MINC */
+#define DMA_MemInc_Enable						((uint32_t)(1 << 7))
+
+/* @ref DMA_Mode_define */
+#define DMA_Mode_Normal							((uint32_t)(0 << 5))		/* Bit 5 CIRC */
+#define DMA_Mode_Circular						((uint32_t)(1 << 5))		/* CNDTR is reloaded automatically after the last transfer */
+
+/* @ref DMA_IRQ_define */
+#define DMA_IRQ_NONE							((uint32_t)(0))
+#define DMA_IRQ_TC								((uint32_t)(1 << 1))		/* Bit 1 TCIE: Transfer complete interrupt enable */
+#define DMA_IRQ_HT								((uint32_t)(1 << 2))		/* Bit 2 HTIE: Half transfer interrupt enable */
+#define DMA_IRQ_TE								((uint32_t)(1 << 3))		/* Bit 3 TEIE: Transfer error interrupt enable */
+
+/* @ref DMA_Request_define (RM0008 Table 78, the channel of each request is fixed by hardware) */
+#define DMA_Request_SPI1_RX						DMA1_Channel2
+#define DMA_Request_SPI1_TX						DMA1_Channel3
+#define DMA_Request_SPI2_RX						DMA1_Channel4
+#define DMA_Request_SPI2_TX						DMA1_Channel5
+#define DMA_Request_USART1_TX					DMA1_Channel4
+#define DMA_Request_USART1_RX					DMA1_Channel5
+#define DMA_Request_USART2_RX					DMA1_Channel6
+#define DMA_Request_USART2_TX					DMA1_Channel7
+#define DMA_Request_USART3_TX					DMA1_Channel2
+#define DMA_Request_USART3_RX					DMA1_Channel3
+#define DMA_Request_I2C1_TX						DMA1_Channel6
+#define DMA_Request_I2C1_RX						DMA1_Channel7
+#define DMA_Request_I2C2_TX						DMA1_Channel4
+#define DMA_Request_I2C2_RX						DMA1_Channel5
+
+/* CCR Bit 0 EN: Channel enable */
+#define DMA_CCR_EN								((uint32_t)(1 << 0))
+
+/* Channel index [0..6] of a DMA1 channel instance */
+#define DMA_CHANNEL_INDEX(_CHANNEL_)			((uint8_t)(((uint32_t)(_CHANNEL_) - DMA1_Channel1_BASE_ADDRESS) / 0x14))
+
+/* ISR / IFCR flags of channel index x [0..6] */
+#define DMA_FLAG_GIF(_INDEX_)					((uint32_t)(1 << ((_INDEX_) * 4 + 0)))
+#define DMA_FLAG_TCIF(_INDEX_)					((uint32_t)(1 << ((_INDEX_) * 4 + 1)))
+#define DMA_FLAG_HTIF(_INDEX_)					((uint32_t)(1 << ((_INDEX_) * 4 + 2)))
+#define DMA_FLAG_TEIF(_INDEX_)					((uint32_t)(1 << ((_INDEX_) * 4 + 3)))
+
+/*******************************************************/
+
+/*******************************************************/
+/******* APIs Supported by "MCAL DMA DRIVER" ***********/
+/*******************************************************/
+
+void MCAL_DMA_Init(DMA_Channel_TypeDef *DMA_Channelx, DMA_Config_t *DMA_Config);
+void MCAL_DMA_DeInit(DMA_Channel_TypeDef *DMA_Channelx);
+
+void MCAL_DMA_Start(DMA_Channel_TypeDef *DMA_Channelx, uint32_t periphAddress, uint32_t memAddress, uint16_t dataLength);
+void MCAL_DMA_Stop(DMA_Channel_TypeDef *DMA_Channelx);
+
+uint16_t MCAL_DMA_GetRemaining(DMA_Channel_TypeDef *DMA_Channelx);
+
+MCAL_Status_t MCAL_DMA_Claim(DMA_Channel_TypeDef *DMA_Channelx, const void *owner);
+DMA_Channel_TypeDef *MCAL_DMA_ClaimAny(const void *owner);
+void MCAL_DMA_Release(DMA_Channel_TypeDef *DMA_Channelx, const void *owner);
+const void *MCAL_DMA_GetOwner(DMA_Channel_TypeDef *DMA_Channelx);
+
+MCAL_Status_t MCAL_DMA_MemCopy(void *pDst, const void *pSrc, uint32_t length, void (* P_Done_CallBack)(MCAL_Status_t status));
+MCAL_Status_t MCAL_DMA_MemSet(void *pDst, uint8_t value, uint32_t length, void (* P_Done_CallBack)(MCAL_Status_t status));
+uint8_t MCAL_DMA_MemIsBusy(void);
+
+/*******************************************************/
+
+#endif /* INC_STM32F103X8_DMA_DRIVER_H_ */
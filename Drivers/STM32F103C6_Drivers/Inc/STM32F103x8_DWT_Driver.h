@@ -0,0 +1,68 @@
+/*
+ * STM32F103x8_DWT_Driver.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ */
+
+#ifndef INC_STM32F103X8_DWT_DRIVER_H_
+#define INC_STM32F103X8_DWT_DRIVER_H_
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include "STM32F103x8.h"
+#include "STM32F103x8_RCC_Driver.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/******** User type definitions (structures) ***********/
+/*******************************************************/
+typedef struct{
+	/**
+	 * @start
+	 * DWT_CYCCNT value when the wait started.
+	 */
+	uint32_t start;
+
+	/**
+	 * @budget
+	 * Allowed number of HCLK cycles, computed once by MCAL_DWT_Timeout_Start().
+	 */
+	uint32_t budget;
+} DWT_Timeout_t;
+
+/*******************************************************/
+
+/*******************************************************/
+/********* Macros Configuration References *************/
+/*******************************************************/
+/* Timeout value (ms) that never expires */
+#define DWT_TIMEOUT_MAX							((uint32_t)0xFFFFFFFF)
+
+/**
+ * Restart the wait with the same budget (one read of DWT_CYCCNT).
+ * Use it to bound every flag of a sequence without recomputing the budget.
+ */
+#define DWT_TIMEOUT_RESTART(_TIMEOUT_)			((_TIMEOUT_).start = DWT_CYCCNT)
+
+/**
+ * 1 once the budget is spent, the only cost inside a wait loop is a subtract and a compare.
+ * The unsigned subtraction keeps it correct when DWT_CYCCNT wraps around.
+ */
+#define DWT_TIMEOUT_EXPIRED(_TIMEOUT_)			((uint32_t)(DWT_CYCCNT - (_TIMEOUT_).start) > (_TIMEOUT_).budget)
+
+/*******************************************************/
+
+/*******************************************************/
+/******* APIs Supported by "MCAL DWT DRIVER" ***********/
+/*******************************************************/
+
+void MCAL_DWT_Init(void);
+
+void MCAL_DWT_Timeout_Start(DWT_Timeout_t *pTimeout, uint32_t timeout);
+
+/*******************************************************/
+
+#endif /* INC_STM32F103X8_DWT_DRIVER_H_ */
@@ -22,7 +22,7 @@
 typedef struct{
 	/**
 	 * @pinNumber
-	 * Specifies the GPIO pins to be configured.
+	 * Specifies the GPIO pins to be configured (one pin or an OR of pins sharing the same mode).
 	 * This parameter must be set based on @ref GPIO_PIN_define.
 	 */
 	uint16_t pinNumber;
@@ -94,6 +94,7 @@ typedef struct{
 /******* APIs Supported by "MCAL GPIO DRIVER" **********/
 /*******************************************************/
 void MCAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_PinConfig_t *PinConfig);
+void MCAL_GPIO_InitPins(GPIO_TypeDef *GPIOx, const GPIO_PinConfig_t *PinConfigs, uint8_t count);
 void MCAL_GPIO_DeInit(GPIO_TypeDef *GPIOx);
 
 uint8_t MCAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t PinNumber);
@@ -101,6 +102,7 @@ uint16_t MCAL_GPIO_ReadPort(GPIO_TypeDef *GPIOx);
 
 void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t PinNumber, uint8_t value);
 void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16_t value);
+void MCAL_GPIO_WriteMasked(GPIO_TypeDef *GPIOx, uint16_t mask, uint16_t value);
 
 void MCAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t PinNumber);
 
@@ -108,4 +110,44 @@ uint8_t MCAL_GPIO_LockPin(GPIO_TypeDef *GPIOx, uint16_t PinNumber);
 
 /*******************************************************/
 
+/*******************************************************/
+/*********** Inline APIs (no call overhead) ************/
+/*******************************************************/
+/**
+ * With a constant port and pin (e.g. #define LED_PIN  GPIOC, GPIO_PIN_13 then MCAL_GPIO_FastSet(LED_PIN))
+ * and optimization on (-O1 or more), each function folds to one store on BSRR / BRR or one load of IDR.
+ * always_inline still removes the call at -O0, but the arguments are then spilled to the stack.
+ * Several pins of one port can be given at once (OR of @ref GPIO_PIN_define).
+ */
+#define GPIO_INLINE							static inline __attribute__((always_inline))
+
+/* Drive the pins high */
+GPIO_INLINE void MCAL_GPIO_FastSet(GPIO_TypeDef *GPIOx, uint16_t PinNumber){
+	GPIOx->BSRR = (uint32_t)PinNumber;
+}
+
+/* Drive the pins low */
+GPIO_INLINE void MCAL_GPIO_FastReset(GPIO_TypeDef *GPIOx, uint16_t PinNumber){
+	GPIOx->BRR = (uint32_t)PinNumber;
+}
+
+/* Write @ref GPIO_PIN_state on the pins, BSRR set half or reset half (a constant value selects it at compile time) */
+GPIO_INLINE void MCAL_GPIO_FastWrite(GPIO_TypeDef *GPIOx, uint16_t PinNumber, uint8_t value){
+	GPIOx->BSRR = (value != GPIO_PIN_RESET) ? (uint32_t)PinNumber : ((uint32_t)PinNumber << 16);
+}
+
+/* Read a pin, @ref GPIO_PIN_state */
+GPIO_INLINE uint8_t MCAL_GPIO_FastRead(GPIO_TypeDef *GPIOx, uint16_t PinNumber){
+	return (GPIOx->IDR & PinNumber) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/* Toggle the pins: one ODR load and one BSRR store, other pins of the port are never written */
+GPIO_INLINE void MCAL_GPIO_FastToggle(GPIO_TypeDef *GPIOx, uint16_t PinNumber){
+	uint32_t odr = GPIOx->ODR;
+
+	GPIOx->BSRR = ((uint32_t)(~odr & PinNumber)) | ((uint32_t)(odr & PinNumber) << 16);
+}
+
+/*******************************************************/
+
 #endif /* INC_STM32F103X8_GPIO_DRIVER_H_ */
@@ -14,6 +14,8 @@
 #include "STM32F103x8.h"
 #include "STM32F103x8_GPIO_Driver.h"
 #include "STM32F103x8_RCC_Driver.h"
+#include "STM32F103x8_DWT_Driver.h"
+#include "STM32F103x8_DMA_Driver.h"
 
 /*******************************************************/
 
@@ -36,6 +38,15 @@ typedef enum
 	I2C_EV_DATA_RCV		// APP_Layer should receive data (I2C slave receive data)
 }Slave_State;
 
+typedef enum
+{
+	I2C_MASTER_DONE,	// Transfer completed (stop or repeated start already issued)
+	I2C_MASTER_NACK,	// AF: address or data byte not acknowledged by the slave
+	I2C_MASTER_ARLO,	// Arbitration lost to another master
+	I2C_MASTER_BERR,	// Misplaced start / stop detected on the bus
+	I2C_MASTER_DMA_ERR	// DMA transfer error (bad buffer address)
+}Master_State;
+
 typedef struct{
 	/**
 	 * @clockSpeed
@@ -65,6 +76,13 @@ typedef struct{
 	 */
 	uint32_t masterMode;
 
+	/**
+	 * @FM_Duty
+	 * Specifies the SCL low/high ratio in Fm mode (ignored in Sm mode).
+	 * This parameter must be set based on @ref I2C_FM_DUTY_DEFINE.
+	 */
+	uint32_t FM_Duty;
+
 	/**
 	 * @mode
 	 * Specifies I2C SMBUS mode or I2C mode.
@@ -109,6 +127,7 @@ typedef struct{
  */
 #define I2C_CLOCK_SPEED_50KHZ					(50000U)
 #define I2C_CLOCK_SPEED_100KHZ					(100000U)
+#define I2C_CLOCK_SPEED_400KHZ					(400000U)		/* Requires @masterMode = I2C_MASTER_MODE_FM */
 
 
 //@ref I2C_STRETCH_MODE_DEFINE
@@ -140,6 +159,15 @@ typedef struct{
 #define I2C_MASTER_MODE_SM						(uint32_t)(0)
 #define I2C_MASTER_MODE_FM						(uint32_t)(1<<15)
 
+// @ref I2C_FM_DUTY_DEFINE
+/* I2C_CCR
+ * Bit 14 DUTY: Fm mode duty cycle
+ * 0: Fm mode tlow/thigh = 2		(PCLK1 must be a multiple of 1.2 MHz to reach exactly 400 kHz)
+ * 1: Fm mode tlow/thigh = 16/9	(PCLK1 must be a multiple of 10 MHz to reach exactly 400 kHz)
+ */
+#define I2C_FM_DUTY_2							(uint32_t)(0)
+#define I2C_FM_DUTY_16_9						(uint32_t)(1<<14)
+
 //@ref I2C_MODE_DEFINE
 /* I2C_CR1
  * Bit 1 SMBUS: SMBus mode
@@ -168,6 +196,13 @@ typedef struct{
 #define I2C_ACK_CONTROL_ENABLE					(uint32_t)(1<<10)
 #define I2C_ACK_CONTROL_DISABLE					(uint32_t)(0)
 
+/* Bound (ms) of each event wait of the master polling APIs
+ * (same order as the 25 ms SMBus clock low timeout)
+ */
+#ifndef I2C_TIMEOUT_DEFAULT
+#define I2C_TIMEOUT_DEFAULT						25U
+#endif
+
 
 
 
@@ -235,7 +270,7 @@ typedef enum
 /******* APIs Supported by "MCAL I2C DRIVER" ***********/
 /*******************************************************/
 
-void MCAL_I2C_Init(I2C_Typedef *I2Cx, I2C_Config_t *I2C_Config);
+MCAL_Status_t MCAL_I2C_Init(I2C_Typedef *I2Cx, I2C_Config_t *I2C_Config);
 void MCAL_I2C_DeInit(I2C_Typedef *I2Cx);
 
 void MCAL_I2C_GPIO_Set_Pins(I2C_Typedef *I2Cx);
@@ -243,8 +278,23 @@ void MCAL_I2C_GPIO_Set_Pins(I2C_Typedef *I2Cx);
 /*
  * Master Polling Mechanism
  */
-void MCAL_I2C_MASTER_TX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pTxData, uint8_t Data_Length, STOP_Condition Stop, START_Condition Start);
-void MCAL_I2C_MASTER_RX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRxData, uint8_t Data_Length, STOP_Condition Stop, START_Condition Start);
+MCAL_Status_t MCAL_I2C_MASTER_TX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pTxData, uint8_t Data_Length, STOP_Condition Stop, START_Condition Start);
+MCAL_Status_t MCAL_I2C_MASTER_RX(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRxData, uint8_t Data_Length, STOP_Condition Stop, START_Condition Start);
+
+
+/*
+ * Master Interrupt Mechanism (non-blocking, completion reported by P_Master_CallBack)
+ */
+MCAL_Status_t MCAL_I2C_MASTER_TX_IT(I2C_Typedef *I2Cx, uint16_t Device_Address, const uint8_t *pTxData, uint16_t Data_Length, void (*P_Master_CallBack)(Master_State state));
+MCAL_Status_t MCAL_I2C_MASTER_RX_IT(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRxData, uint16_t Data_Length, void (*P_Master_CallBack)(Master_State state));
+MCAL_Status_t MCAL_I2C_MASTER_TX_RX_IT(I2C_Typedef *I2Cx, uint16_t Device_Address, const uint8_t *pTxData, uint16_t TxLength, uint8_t *pRxData, uint16_t RxLength, void (*P_Master_CallBack)(Master_State state));
+
+
+/*
+ * Master DMA Mechanism (DMA1: I2C1 TX Channel6 / RX Channel7, I2C2 TX Channel4 / RX Channel5)
+ */
+MCAL_Status_t MCAL_I2C_MASTER_TX_DMA(I2C_Typedef *I2Cx, uint16_t Device_Address, const uint8_t *pTxData, uint16_t Data_Length, void (*P_Master_CallBack)(Master_State state));
+MCAL_Status_t MCAL_I2C_MASTER_RX_DMA(I2C_Typedef *I2Cx, uint16_t Device_Address, uint8_t *pRxData, uint16_t Data_Length, void (*P_Master_CallBack)(Master_State state));
 
 
 /*
@@ -259,7 +309,7 @@ uint8_t MCAL_I2C_Slave_RX(I2C_Typedef *I2Cx);
  */
 I2C_Flagstatus I2C_Get_FlagStatus(I2C_Typedef *I2Cx, Status Flag);
 
-void I2C_Generate_Start(I2C_Typedef *I2Cx,START_Condition Start, Functional_State State);
+MCAL_Status_t I2C_Generate_Start(I2C_Typedef *I2Cx,START_Condition Start, Functional_State State);
 void I2C_Send_Address(I2C_Typedef *I2Cx, uint16_t Device_Address,I2C_Direction Direction);
 void I2C_Stop(I2C_Typedef *I2Cx, Functional_State State);
 void I2C_ACKConfig(I2C_Typedef *I2Cx, Functional_State State);
@@ -16,16 +16,191 @@
 
 /*******************************************************/
 
+/*******************************************************/
+/******** User type definitions (structures) ***********/
+/*******************************************************/
+typedef struct{
+	/**
+	 * @SYSCLK_Source
+	 * Specifies the system clock source.
+	 * this parameter must be set based on @ref RCC_SYSCLK_Source_define.
+	 */
+	uint32_t SYSCLK_Source;
+
+	/**
+	 * @PLL_Source
+	 * Specifies the PLL entry clock (ignored if the PLL is not the system clock).
+	 * this parameter must be set based on @ref RCC_PLL_Source_define.
+	 */
+	uint32_t PLL_Source;
+
+	/**
+	 * @PLL_Mul
+	 * Specifies the PLL multiplication factor (PLL output must be 16..72 MHz).
+	 * this parameter must be set based on @ref RCC_PLL_Mul_define.
+	 */
+	uint32_t PLL_Mul;
+
+	/**
+	 * @AHB_Prescaler
+	 * Specifies the HCLK divider of SYSCLK.
+	 * this parameter must be set based on @ref RCC_AHB_Prescaler_define.
+	 */
+	uint32_t AHB_Prescaler;
+
+	/**
+	 * @APB1_Prescaler
+	 * Specifies the PCLK1 divider of HCLK (PCLK1 must not exceed 36 MHz).
+	 * this parameter must be set based on @ref RCC_APB_Prescaler_define.
+	 */
+	uint32_t APB1_Prescaler;
+
+	/**
+	 * @APB2_Prescaler
+	 * Specifies the PCLK2 divider of HCLK.
+	 * this parameter must be set based on @ref RCC_APB_Prescaler_define.
+	 */
+	uint32_t APB2_Prescaler;
+} RCC_Config_t;
+
+typedef struct{
+	uint32_t SYSCLK_Freq;	/* System clock */
+	uint32_t HCLK_Freq;		/* AHB bus, core and DMA */
+	uint32_t PCLK1_Freq;	/* APB1 bus: USART2/3, SPI2, I2C1/2 */
+	uint32_t PCLK2_Freq;	/* APB2 bus: USART1, SPI1, GPIO */
+} RCC_Clocks_t;
+
+typedef struct{
+	/**
+	 * @pProfiles
+	 * Clock profiles ordered from the fastest to the slowest (must stay valid while the governor runs).
+	 * profiles can be built with @ref RCC_Profile_define.
+	 */
+	const RCC_Config_t *pProfiles;
+
+	/**
+	 * @Profiles_Count
+	 * Number of entries in pProfiles (1..255).
+	 */
+	uint8_t Profiles_Count;
+
+	/**
+	 * @Window_Ticks
+	 * Number of MCAL_RCC_Governor_Tick() calls the idle percentage is measured over.
+	 */
+	uint16_t Window_Ticks;
+
+	/**
+	 * @Idle_Down_Percent
+	 * Idle percentage at or above which the governor steps one profile slower.
+	 */
+	uint8_t Idle_Down_Percent;
+
+	/**
+	 * @Idle_Up_Percent
+	 * Idle percentage below which the governor goes back to the fastest profile (must be < Idle_Down_Percent).
+	 */
+	uint8_t Idle_Up_Percent;
+
+	/**
+	 * @Keep_PLL
+	 * Keeps the PLL locked in the slow profiles, a boost is then only a clock switch.
+	 * this parameter must be set based on @ref RCC_Governor_Keep_PLL_define.
+	 */
+	uint8_t Keep_PLL;
+} RCC_Governor_Config_t;
+
+/* Called after every change of the clock tree with the new bus frequencies */
+typedef void (* RCC_ClockChange_CallBack_t)(const RCC_Clocks_t *pClocks);
+
+/* Asked by the governor before a profile switch, returns 1 while a clock change would break a transfer */
+typedef uint8_t (* RCC_Busy_CallBack_t)(void);
+
+/*******************************************************/
+
 /*******************************************************/
 /********* Macros Configuration References *************/
 /*******************************************************/
+/* External crystal of the board, can be overridden by the build */
+#ifndef HSE_CLOCK
 #define HSE_CLOCK 			(uint32_t)16000000UL
+#endif
 #define HSI_RC_CLOCK 		(uint32_t)8000000UL
 
+/* @ref RCC_SYSCLK_Source_define */
+#define RCC_SYSCLK_Source_HSI					((uint32_t)(0b00 << 0))		/* CFGR Bits 1:0 SW */
+#define RCC_SYSCLK_Source_HSE					((uint32_t)(0b01 << 0))
+#define RCC_SYSCLK_Source_PLL					((uint32_t)(0b10 << 0))
+
+/* @ref RCC_PLL_Source_define */
+#define RCC_PLL_Source_HSI_Div2					((uint32_t)(0))							/* CFGR Bit 16 PLLSRC */
+#define RCC_PLL_Source_HSE						((uint32_t)(1 << 16))
+#define RCC_PLL_Source_HSE_Div2					((uint32_t)((1 << 16) | (1 << 17)))		/* Bit 17 PLLXTPRE */
+
+/* @ref RCC_PLL_Mul_define */
+#define RCC_PLL_Mul_2							((uint32_t)(0b0000 << 18))	/* CFGR Bits 21:18 PLLMUL */
+#define RCC_PLL_Mul_3							((uint32_t)(0b0001 << 18))
+#define RCC_PLL_Mul_4							((uint32_t)(0b0010 << 18))
+#define RCC_PLL_Mul_5							((uint32_t)(0b0011 << 18))
+#define RCC_PLL_Mul_6							((uint32_t)(0b0100 << 18))
+#define RCC_PLL_Mul_7							((uint32_t)(0b0101 << 18))
+#define RCC_PLL_Mul_8							((uint32_t)(0b0110 << 18))
+#define RCC_PLL_Mul_9							((uint32_t)(0b0111 << 18))
+#define RCC_PLL_Mul_10							((uint32_t)(0b1000 << 18))
+#define RCC_PLL_Mul_11							((uint32_t)(0b1001 << 18))
+#define RCC_PLL_Mul_12							((uint32_t)(0b1010 << 18))
+#define RCC_PLL_Mul_13							((uint32_t)(0b1011 << 18))
+#define RCC_PLL_Mul_14							((uint32_t)(0b1100 << 18))
+#define RCC_PLL_Mul_15							((uint32_t)(0b1101 << 18))
+#define RCC_PLL_Mul_16							((uint32_t)(0b1110 << 18))
+
+/* @ref RCC_AHB_Prescaler_define */
+#define RCC_AHB_Prescaler_DIV1					((uint32_t)(0b0000 << 4))	/* CFGR Bits 7:4 HPRE */
+#define RCC_AHB_Prescaler_DIV2					((uint32_t)(0b1000 << 4))
+#define RCC_AHB_Prescaler_DIV4					((uint32_t)(0b1001 << 4))
+#define RCC_AHB_Prescaler_DIV8					((uint32_t)(0b1010 << 4))
+#define RCC_AHB_Prescaler_DIV16					((uint32_t)(0b1011 << 4))
+#define RCC_AHB_Prescaler_DIV64					((uint32_t)(0b1100 << 4))
+#define RCC_AHB_Prescaler_DIV128				((uint32_t)(0b1101 << 4))
+#define RCC_AHB_Prescaler_DIV256				((uint32_t)(0b1110 << 4))
+#define RCC_AHB_Prescaler_DIV512				((uint32_t)(0b1111 << 4))
+
+/* @ref RCC_APB_Prescaler_define (same code for PPRE1 Bits 10:8 and PPRE2 Bits 13:11) */
+#define RCC_APB_Prescaler_DIV1					((uint32_t)(0b000))
+#define RCC_APB_Prescaler_DIV2					((uint32_t)(0b100))
+#define RCC_APB_Prescaler_DIV4					((uint32_t)(0b101))
+#define RCC_APB_Prescaler_DIV8					((uint32_t)(0b110))
+#define RCC_APB_Prescaler_DIV16					((uint32_t)(0b111))
+
+/* @ref RCC_Profile_define (SYSCLK / HCLK, PCLK1, PCLK2) */
+#define RCC_PROFILE_72MHZ_PLL					{ RCC_SYSCLK_Source_PLL, RCC_PLL_Source_HSE_Div2, RCC_PLL_Mul_9,  RCC_AHB_Prescaler_DIV1, RCC_APB_Prescaler_DIV2, RCC_APB_Prescaler_DIV1 }	/* 72, 36, 72 MHz (HSE_CLOCK = 16 MHz) */
+#define RCC_PROFILE_64MHZ_PLL_HSI				{ RCC_SYSCLK_Source_PLL, RCC_PLL_Source_HSI_Div2, RCC_PLL_Mul_16, RCC_AHB_Prescaler_DIV1, RCC_APB_Prescaler_DIV2, RCC_APB_Prescaler_DIV1 }	/* 64, 32, 64 MHz */
+#define RCC_PROFILE_8MHZ_HSI					{ RCC_SYSCLK_Source_HSI, RCC_PLL_Source_HSI_Div2, RCC_PLL_Mul_2,  RCC_AHB_Prescaler_DIV1, RCC_APB_Prescaler_DIV1, RCC_APB_Prescaler_DIV1 }	/* 8, 8, 8 MHz */
+#define RCC_PROFILE_4MHZ_HSI					{ RCC_SYSCLK_Source_HSI, RCC_PLL_Source_HSI_Div2, RCC_PLL_Mul_2,  RCC_AHB_Prescaler_DIV2, RCC_APB_Prescaler_DIV1, RCC_APB_Prescaler_DIV1 }	/* 4, 4, 4 MHz (lowest that keeps I2C and 115200 baud) */
+
+/* @ref RCC_Governor_Keep_PLL_define */
+#define RCC_Governor_Keep_PLL_Disable			0
+#define RCC_Governor_Keep_PLL_Enable			1
+
+/* Number of drivers / application modules that can follow the clock changes */
+#ifndef RCC_MAX_SUBSCRIBERS
+#define RCC_MAX_SUBSCRIBERS						8U
+#endif
+
+/* Number of drivers / application modules that can hold back a governor switch */
+#ifndef RCC_MAX_BUSY_QUERIES
+#define RCC_MAX_BUSY_QUERIES					4U
+#endif
+
+/* Bound (ms) of the oscillator / PLL ready and clock switch waits */
+#ifndef RCC_TIMEOUT_DEFAULT
+#define RCC_TIMEOUT_DEFAULT						100U
+#endif
+
 /*******************************************************/
 
 /*******************************************************/
-/******* APIs Supported by "MCAL GPIO DRIVER" **********/
+/******* APIs Supported by "MCAL RCC DRIVER" ***********/
 /*******************************************************/
 uint32_t MCAL_RCC_GetSYSCLKFreq(void); /* get SYSCLK bus Frequency */
 
@@ -33,6 +208,24 @@ uint32_t MCAL_RCC_GetHCLKFreq(void); /* get AHB bus Frequency */
 uint32_t MCAL_RCC_GetPCLK1Freq(void); /* get APB1 bus Frequency */
 uint32_t MCAL_RCC_GetPCLK2Freq(void); /* get APB2 bus Frequency */
 
+void MCAL_RCC_GetClocks(RCC_Clocks_t *pClocks); /* get all bus Frequencies at once */
+
+MCAL_Status_t MCAL_RCC_ClockConfig(const RCC_Config_t *RCC_Config); /* set SYSCLK source, PLL, bus prescalers and Flash wait states */
+void MCAL_RCC_UpdateClocks(void); /* re-read the clock tree and notify the subscribers if it changed */
+
+MCAL_Status_t MCAL_RCC_Subscribe(RCC_ClockChange_CallBack_t P_ClockChange_CallBack);
+void MCAL_RCC_Unsubscribe(RCC_ClockChange_CallBack_t P_ClockChange_CallBack);
+
+MCAL_Status_t MCAL_RCC_AddBusyQuery(RCC_Busy_CallBack_t P_Busy_CallBack);
+void MCAL_RCC_RemoveBusyQuery(RCC_Busy_CallBack_t P_Busy_CallBack);
+
+MCAL_Status_t MCAL_RCC_Governor_Init(const RCC_Governor_Config_t *Governor_Config); /* start on the fastest profile */
+void MCAL_RCC_Governor_Tick(void); /* call from a periodic interrupt */
+void MCAL_RCC_Governor_Idle(void); /* call from the main loop when there is nothing to do */
+MCAL_Status_t MCAL_RCC_Governor_Boost(void); /* go to the fastest profile now */
+uint8_t MCAL_RCC_Governor_GetProfile(void); /* index of the running profile */
+uint8_t MCAL_RCC_Governor_GetIdlePercent(void); /* idle percentage of the last window */
+
 /*******************************************************/
 
 #endif /* INC_STM32F103X8_RCC_DRIVER_H_ */
@@ -13,6 +13,9 @@
 /*******************************************************/
 #include "STM32F103x8.h"
 #include "STM32F103x8_GPIO_Driver.h"
+#include "STM32F103x8_EXTI_Driver.h"
+#include "STM32F103x8_DWT_Driver.h"
+#include "STM32F103x8_DMA_Driver.h"
 
 /*******************************************************/
 
@@ -90,6 +93,20 @@ typedef struct{
 	 */
 	uint16_t IRQ_Enable;
 
+	/**
+	 * @CRC_Enable
+	 * Hardware CRC appended / checked by the block and DMA APIs (CRC8 with 8-bit frames, CRC16 with 16-bit frames).
+	 * this parameter must be set based on @ref SPI_CRC_define.
+	 */
+	uint16_t CRC_Enable;
+
+	/**
+	 * @CRC_Polynomial
+	 * CRC polynomial (CRCPR), 0 selects SPI_CRC_POLYNOMIAL_DEFAULT.
+	 * e.g. 0x07 (CRC-8), 0x1021 (CRC-16-CCITT), 0x8005 (CRC-16).
+	 */
+	uint16_t CRC_Polynomial;
+
 	/**
 	 * @P_IRQ_Callback
 	 * Set the C Function() which will be called once the IRQ Happen.
@@ -97,6 +114,98 @@ typedef struct{
 	void (* P_IRQ_Callback) (struct S_IRQ_SRC irq_SCR);
 } SPI_Config_t;
 
+typedef struct{
+	/**
+	 * @CS_Port
+	 * GPIO port of the device chip select (driven low during its transactions).
+	 */
+	GPIO_TypeDef *CS_Port;
+
+	/**
+	 * @CS_Pin
+	 * GPIO pin of the device chip select.
+	 * this parameter must be set based on @ref GPIO_PIN_define.
+	 */
+	uint16_t CS_Pin;
+
+	/**
+	 * @frameFormat, @dataSize, @CLK_Polarity, @CLK_Phase
+	 * Device frame settings, same values as SPI_Config_t.
+	 */
+	uint16_t frameFormat;
+	uint16_t dataSize;
+	uint16_t CLK_Polarity;
+	uint16_t CLK_Phase;
+
+	/**
+	 * @CLK_Frequency
+	 * Device SCK prescaler at the current clock, kept as a frequency on clock changes.
+	 * this parameter must be set based on @ref SPI_CLK_Frequency_define.
+	 */
+	uint16_t CLK_Frequency;
+
+	/**
+	 * @SPIx, @SCK_Freq
+	 * Filled by MCAL_SPI_Bus_AddDevice().
+	 */
+	SPI_Typedef *SPIx;
+	uint32_t SCK_Freq;
+} SPI_Device_t;
+
+typedef struct SPI_Transaction{
+	/**
+	 * @pDevice
+	 * Target device, registered by MCAL_SPI_Bus_AddDevice().
+	 */
+	SPI_Device_t *pDevice;
+
+	/**
+	 * @pTxBuffer, @pRxBuffer, @length
+	 * Same meaning as MCAL_SPI_Transfer_DMA(), buffers must stay valid until the callback.
+	 */
+	const void *pTxBuffer;
+	void *pRxBuffer;
+	uint16_t length;
+
+	/**
+	 * @P_Done_CallBack
+	 * Called from the DMA interrupt once the chip select is released (can be NULL).
+	 * status: MCAL_OK, MCAL_ERROR (DMA error), MCAL_BUSY (DMA channel claimed by another driver).
+	 */
+	void (* P_Done_CallBack)(struct SPI_Transaction *pTransaction, MCAL_Status_t status);
+
+	/**
+	 * @pContext
+	 * Free for the application.
+	 */
+	void *pContext;
+} SPI_Transaction_t;
+
+typedef struct{
+	/**
+	 * @pRxRing, @RxRing_Length
+	 * Circular receive buffer (frames) filled by DMA from the host, read with MCAL_SPI_Slave_Read().
+	 * It must hold the frames received between two reads, older frames are overwritten.
+	 */
+	void *pRxRing;
+	uint16_t RxRing_Length;
+
+	/**
+	 * @pTxBuffer, @TxLength
+	 * Response pre-loaded before each transaction and clocked out by DMA (NULL: SPI_DUMMY_FRAME).
+	 * It is sent again in every transaction until MCAL_SPI_Slave_SetResponse().
+	 */
+	const void *pTxBuffer;
+	uint16_t TxLength;
+
+	/**
+	 * @P_Event_CallBack
+	 * Called from the NSS EXTI interrupt (can be NULL).
+	 * event: @ref SPI_Slave_Event_define, frames: frames received in the transaction (SPI_Slave_Event_Deselect).
+	 */
+	void (* P_Event_CallBack)(uint8_t event, uint16_t frames);
+} SPI_Slave_Config_t;
+
 /*******************************************************/
 
 /*******************************************************/
@@ -131,7 +240,7 @@ typedef struct{
 /* @ref SPI_NSS_define */
 #define SPI_NSS_HW_Slave                          (0x00000000UL)
 #define SPI_NSS_HW_Master_ss_output_Enable        (0x1U << 2)
-#define SPI_NSS_HW_Master_ss_output_Disable       ~(0x1U << 2)
+#define SPI_NSS_HW_Master_ss_output_Disable       ((uint16_t)~(0x1U << 2))   // Same width as @NSS so it compares equal
 
 #define SPI_NSS_SW_Set_SSI                        (0x1U<<9) | (0x1U<<8)
 #define SPI_NSS_SW_Reset_SSI                      (0x1U<<9)
@@ -152,6 +261,43 @@ typedef struct{
 #define SPI_IRQ_Enable_RXNEIE                      (uint32_t)(1 << 6)     // RX buffer not empty interrupt enable
 #define SPI_IRQ_Enable_ERRIE                       (uint32_t)(1 << 5)     // Error interrupt enable
 
+/* @ref SPI_CRC_define */
+#define SPI_CRC_Disable                            (0x00000000UL)
+#define SPI_CRC_Enable                             (0x1U << 13)           // Bit 13 CRCEN: Hardware CRC calculation enable
+
+/* CRCPR reset value */
+#ifndef SPI_CRC_POLYNOMIAL_DEFAULT
+#define SPI_CRC_POLYNOMIAL_DEFAULT              0x0007U
+#endif
+
+/* @ref SPI_Byte_Order_define */
+#define SPI_Byte_Order_Stream                     0     // Bytes on the wire in buffer order, as with 8-bit frames
+#define SPI_Byte_Order_HalfWord                   1     // Each uint16_t of the buffer is one frame (no swap, DMA friendly)
+
+/* @ref SPI_Stream_Half_define */
+#define SPI_Stream_Half_First                     0     // First half done, refill / read it
+#define SPI_Stream_Half_Second                    1     // Second half done, refill / read it
+#define SPI_Stream_Error                          2     // DMA transfer error, the stream is stopped and its channels released
+
+/* @ref SPI_Slave_Event_define */
+#define SPI_Slave_Event_Select                    0     // NSS falling edge, the host starts a transaction
+#define SPI_Slave_Event_Deselect                  1     // NSS rising edge, the transaction is over and the response re-armed
+
+/* Pending transactions per bus (power of 2) */
+#ifndef SPI_BUS_QUEUE_SIZE
+#define SPI_BUS_QUEUE_SIZE                      8U
+#endif
+
+/* Frame clocked out by MCAL_SPI_Receive() / MCAL_SPI_Transfer() without TX buffer */
+#ifndef SPI_DUMMY_FRAME
+#define SPI_DUMMY_FRAME                         0xFFFFU
+#endif
+
+/* Bound (ms) of each flag wait in the polling APIs */
+#ifndef SPI_TIMEOUT_DEFAULT
+#define SPI_TIMEOUT_DEFAULT                     10U
+#endif
+
 enum Polling_Mech{
 	Enable,
 	Disable
@@ -168,10 +314,44 @@ void MCAL_SPI_Deinit(SPI_Typedef *SPIx);
 
 void MCAL_SPI_GPIO_SET_PINs(SPI_Typedef *SPIx);
 
-void MCAL_SPI_SendData(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech pollingEN);
-void MCAL_SPI_ReceiveData(SPI_Typedef *SPIx, uint16_t *RX_Buffer, enum Polling_Mech pollingEN);
+MCAL_Status_t MCAL_SPI_SendData(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech pollingEN);
+MCAL_Status_t MCAL_SPI_ReceiveData(SPI_Typedef *SPIx, uint16_t *RX_Buffer, enum Polling_Mech pollingEN);
+
+MCAL_Status_t MCAL_SPI_TX_RX(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech pollingEN);
+
+MCAL_Status_t MCAL_SPI_Transfer(SPI_Typedef *SPIx, const void *pTxBuffer, void *pRxBuffer, size_t length);
+MCAL_Status_t MCAL_SPI_Transmit(SPI_Typedef *SPIx, const void *pTxBuffer, size_t length);
+MCAL_Status_t MCAL_SPI_Receive(SPI_Typedef *SPIx, void *pRxBuffer, size_t length);
+
+MCAL_Status_t MCAL_SPI_Transfer_Packed(SPI_Typedef *SPIx, const uint8_t *pTxBuffer, uint8_t *pRxBuffer, size_t length, uint8_t byteOrder);
+
+/*
+ * DMA Mechanism (DMA1: SPI1 RX Channel2 / TX Channel3, SPI2 RX Channel4 / TX Channel5)
+ */
+MCAL_Status_t MCAL_SPI_Transfer_DMA(SPI_Typedef *SPIx, const void *pTxBuffer, void *pRxBuffer, uint16_t length, void (* P_Done_CallBack)(MCAL_Status_t status));
+MCAL_Status_t MCAL_SPI_Transmit_DMA(SPI_Typedef *SPIx, const void *pTxBuffer, uint16_t length, void (* P_Done_CallBack)(MCAL_Status_t status));
+MCAL_Status_t MCAL_SPI_Receive_DMA(SPI_Typedef *SPIx, void *pRxBuffer, uint16_t length, void (* P_Done_CallBack)(MCAL_Status_t status));
+
+MCAL_Status_t MCAL_SPI_StartStream_DMA(SPI_Typedef *SPIx, const void *pTxBuffer, void *pRxBuffer, uint16_t length, void (* P_Half_CallBack)(uint8_t half));
+void MCAL_SPI_StopStream_DMA(SPI_Typedef *SPIx);
 
-void MCAL_SPI_TX_RX(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech pollingEN);
+MCAL_Status_t MCAL_SPI_Transfer_Packed_DMA(SPI_Typedef *SPIx, const uint8_t *pTxBuffer, uint8_t *pRxBuffer, uint16_t length, uint8_t byteOrder, void (* P_Done_CallBack)(MCAL_Status_t status));
+
+/*
+ * Bus Manager (several devices on one master SPI, GPIO chip selects, transactions queued and run by DMA)
+ */
+MCAL_Status_t MCAL_SPI_Bus_AddDevice(SPI_Typedef *SPIx, SPI_Device_t *pDevice);
+MCAL_Status_t MCAL_SPI_Bus_Submit(SPI_Transaction_t *pTransaction);
+uint8_t MCAL_SPI_Bus_IsIdle(SPI_Typedef *SPIx);
+
+/*
+ * Slave Engine (RX ring and pre-loaded response moved by DMA, transactions framed by NSS through EXTI: SPI1 PA4, SPI2 PB12)
+ */
+MCAL_Status_t MCAL_SPI_Slave_Start(SPI_Typedef *SPIx, const SPI_Slave_Config_t *pConfig);
+void MCAL_SPI_Slave_Stop(SPI_Typedef *SPIx);
+MCAL_Status_t MCAL_SPI_Slave_SetResponse(SPI_Typedef *SPIx, const void *pTxBuffer, uint16_t length);
+uint16_t MCAL_SPI_Slave_Available(SPI_Typedef *SPIx);
+uint16_t MCAL_SPI_Slave_Read(SPI_Typedef *SPIx, void *pBuffer, uint16_t length);
 
 /*******************************************************/
 
@@ -14,6 +14,8 @@
 #include "STM32F103x8.h"
 #include "STM32F103x8_GPIO_Driver.h"
 #include "STM32F103x8_RCC_Driver.h"
+#include "STM32F103x8_DMA_Driver.h"
+#include "STM32F103x8_DWT_Driver.h"
 
 /*******************************************************/
 
@@ -41,35 +43,43 @@ typedef struct{
 	 * Specifies number of data bits transmitted or received in a frame.
 	 * this parameter must be set based on @ref USART_PayloadLength_define.
 	 */
-	uint8_t payloadLength;
+	uint16_t payloadLength;
 
 	/**
 	 * @parity
 	 * Specifies the parity mode.
 	 * this parameter must be set based on @ref USART_Parity_define.
 	 */
-	uint8_t parity;
+	uint16_t parity;
 
 	/**
 	 * @stopBits
 	 * Specifies number of stop bits in a frame.
 	 * this parameter must be set based on @ref USART_StopBits_define.
 	 */
-	uint8_t stopBits;
+	uint16_t stopBits;
 
 	/**
 	 * @HW_FlowCtl
 	 * Specifies whether the hardware flow control mode is enabled or disabled.
 	 * this parameter must be set based on @ref USART_HwFlowCtl_define.
 	 */
-	uint8_t HW_FlowCtl;
+	uint16_t HW_FlowCtl;
 
 	/**
 	 * @IRQ_EN
 	 * Enable or Disable IRQ Tx/Rx.
 	 * this parameter must be set based on @ref USART_IRQ_define.
 	 */
-	uint8_t IRQ_EN;
+	uint16_t IRQ_EN;
+
+	/**
+	 * @RxBuffer
+	 * Enable or Disable reception into the driver ring buffer (RXNE interrupt is used).
+	 * Received frames are then fetched with MCAL_USART_Read().
+	 * this parameter must be set based on @ref USART_RxBuffer_define.
+	 */
+	uint8_t RxBuffer;
 
 	/**
 	 * @P_IRQ_CallBack
@@ -78,6 +88,26 @@ typedef struct{
 	void(* P_IRQ_CallBack)(void);
 } USART_Config_t;
 
+typedef struct{
+	/**
+	 * @overrunCount
+	 * Frames dropped because the ring buffer was full.
+	 */
+	uint32_t overrunCount;
+
+	/**
+	 * @hwOverrunCount
+	 * Frames lost in hardware (ORE flag) because RXNE was not served in time.
+	 */
+	uint32_t hwOverrunCount;
+
+	/**
+	 * @highWaterMark
+	 * Maximum number of frames ever waiting in the ring buffer.
+	 */
+	uint16_t highWaterMark;
+} USART_RxStats_t;
+
 /*******************************************************/
 
 /*******************************************************/
@@ -127,6 +157,28 @@ typedef struct{
 #define USART_IRQ_TC					((uint32_t)(1<<6))
 #define USART_IRQ_RXNE					((uint32_t)(1<<5))
 #define USART_IRQ_PE					((uint32_t)(1<<8))
+#define USART_IRQ_IDLE					((uint32_t)(1<<4))
+
+/* @ref USART_RxBuffer_define */
+#define USART_RxBuffer_DISABLE			0
+#define USART_RxBuffer_ENABLE			1
+
+/* RX ring buffer size in frames per USART instance (must be a power of two) */
+#ifndef USART_RX_BUFFER_SIZE
+#define USART_RX_BUFFER_SIZE			64
+#endif
+
+#if (USART_RX_BUFFER_SIZE & (USART_RX_BUFFER_SIZE - 1)) || (USART_RX_BUFFER_SIZE > 32768)
+#error "USART_RX_BUFFER_SIZE must be a power of two (up to 32768)"
+#endif
+
+/* Timeout of MCAL_USART_Write() / MCAL_USART_Read() that never expires */
+#define USART_TIMEOUT_MAX				DWT_TIMEOUT_MAX
+
+/* Bound (ms) of each flag wait in MCAL_USART_SendData() / ReceiveData() / Wait_Tc() */
+#ifndef USART_TIMEOUT_DEFAULT
+#define USART_TIMEOUT_DEFAULT			100U
+#endif
 
 enum Polling_mechanism{
 	enable,
@@ -159,10 +211,19 @@ void MCAL_USART_DeInit(USART_TypeDef *USARTx);
 
 void MCAL_USART_GPIO_Set_Pins(USART_TypeDef *USARTx);
 
-void MCAL_USART_SendData(USART_TypeDef *USARTx, uint16_t *pTxBuffer, enum Polling_mechanism PollingEn);
-void MCAL_USART_ReceiveData(USART_TypeDef *USARTx, uint16_t *pRxBuffer, enum Polling_mechanism PollingEn);
+MCAL_Status_t MCAL_USART_SendData(USART_TypeDef *USARTx, uint16_t *pTxBuffer, enum Polling_mechanism PollingEn);
+MCAL_Status_t MCAL_USART_ReceiveData(USART_TypeDef *USARTx, uint16_t *pRxBuffer, enum Polling_mechanism PollingEn);
+
+MCAL_Status_t MCAL_USART_Wait_Tc(USART_TypeDef *USARTx);
+
+size_t MCAL_USART_Write(USART_TypeDef *USARTx, const void *pTxBuffer, size_t length, uint32_t timeout);
+size_t MCAL_USART_Read(USART_TypeDef *USARTx, void *pRxBuffer, size_t length, uint32_t timeout);
+void MCAL_USART_GetRxStats(USART_TypeDef *USARTx, USART_RxStats_t *pStats);
+
+MCAL_Status_t MCAL_USART_SendBuffer_DMA(USART_TypeDef *USARTx, const uint8_t *pTxBuffer, uint16_t length, void (* P_TxCplt_CallBack)(MCAL_Status_t status));
 
-void MCAL_USART_Wait_Tc(USART_TypeDef *USARTx);
+MCAL_Status_t MCAL_USART_ReceiveToIdle_DMA(USART_TypeDef *USARTx, uint8_t *pRxBuffer, uint16_t length, void (* P_Frame_CallBack)(uint16_t offset, uint16_t length));
+void MCAL_USART_StopReceive_DMA(USART_TypeDef *USARTx);
 
 /*******************************************************/
 
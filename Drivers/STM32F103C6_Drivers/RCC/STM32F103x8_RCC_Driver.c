@@ -9,6 +9,7 @@
 /********************* Includes ************************/
 /*******************************************************/
 #include "STM32F103x8_RCC_Driver.h"
+#include "STM32F103x8_DWT_Driver.h"
 
 /*******************************************************/
 
@@ -40,22 +41,108 @@ Warning: the software has to set correctly these bits to not exceed 36 MHz on th
 111: HCLK divided by 16 */
 const uint8_t APB_PrescTable[8U] = {0, 0, 0, 0, 1, 2, 3, 4}; /* each shift 1 right = divide by 2 */
 
+/* Snapshot of the clock tree, the getters read it instead of decoding CFGR every call */
+static RCC_Clocks_t Global_RCC_Clocks;
+static uint8_t Global_RCC_Clocks_Valid = 0;
+
+static RCC_ClockChange_CallBack_t Global_RCC_Subscribers[RCC_MAX_SUBSCRIBERS];
+
+static RCC_Busy_CallBack_t Global_RCC_BusyQueries[RCC_MAX_BUSY_QUERIES];
+
+typedef struct{
+	RCC_Governor_Config_t config;
+	uint8_t enabled;
+	volatile uint8_t profile;		/* running profile */
+	volatile uint8_t target;		/* profile decided by the last window */
+	volatile uint8_t inIdle;		/* set around WFI by MCAL_RCC_Governor_Idle() */
+	volatile uint8_t switching;		/* MCAL_RCC_ClockConfig() in progress */
+	volatile uint8_t idlePercent;	/* result of the last window */
+	uint16_t ticks;
+	uint16_t idleTicks;
+} RCC_Governor_t;
+
+static RCC_Governor_t Global_RCC_Governor;
+
 /*******************************************************/
 
 /*******************************************************/
-/******* APIs Supported by "MCAL EXTI DRIVER" **********/
+/***************** Generic Macros **********************/
+/*******************************************************/
+#define RCC_CR_HSION						((uint32_t)(1 << 0))	/* Bit 0 HSION: Internal high-speed clock enable */
+#define RCC_CR_HSIRDY						((uint32_t)(1 << 1))	/* Bit 1 HSIRDY: Internal high-speed clock ready flag */
+#define RCC_CR_HSEON						((uint32_t)(1 << 16))	/* Bit 16 HSEON: HSE clock enable */
+#define RCC_CR_HSERDY						((uint32_t)(1 << 17))	/* Bit 17 HSERDY: External high-speed clock ready flag */
+#define RCC_CR_PLLON						((uint32_t)(1 << 24))	/* Bit 24 PLLON: PLL enable */
+#define RCC_CR_PLLRDY						((uint32_t)(1 << 25))	/* Bit 25 PLLRDY: PLL clock ready flag */
+
+#define RCC_CFGR_SW_Msk						((uint32_t)(0b11 << 0))		/* Bits 1:0 SW: System clock switch */
+#define RCC_CFGR_SWS_Msk					((uint32_t)(0b11 << 2))		/* Bits 3:2 SWS: System clock switch status */
+#define RCC_CFGR_HPRE_Msk					((uint32_t)(0xF << 4))		/* Bits 7:4 HPRE: AHB prescaler */
+#define RCC_CFGR_PPRE_Msk					((uint32_t)(0x3F << 8))		/* Bits 13:8 PPRE2 / PPRE1: APB prescalers */
+#define RCC_CFGR_PLLSRC						((uint32_t)(1 << 16))		/* Bit 16 PLLSRC: PLL entry clock source */
+#define RCC_CFGR_PLLXTPRE					((uint32_t)(1 << 17))		/* Bit 17 PLLXTPRE: HSE divider for PLL entry */
+#define RCC_CFGR_PLLMUL_Msk					((uint32_t)(0xF << 18))		/* Bits 21:18 PLLMUL: PLL multiplication factor */
+
+#define FLASH_ACR_LATENCY_Msk				((uint32_t)(0b111 << 0))	/* Bits 2:0 LATENCY: wait states */
+#define FLASH_ACR_PRFTBE					((uint32_t)(1 << 4))		/* Bit 4 PRFTBE: Prefetch buffer enable */
+
 /*******************************************************/
 
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
 /**===============================================================================================
- * @FName			- MCAL_RCC_GetSYSCLKFreq
- * @Brief 			- get SYSCLK bus Frequency
- * @Return Value	- SYSCLK bus Frequency
- * @Note			- This function does not support fully functionality
- * 					  where it works only assuming that the clock source
- * 					  for the system is HSI source (its functionality can be improved later)
+ * @FName			- RCC_Get_PLLFreq
+ * @Brief 			- PLL output frequency of a CFGR value
+ * @Parameter [in] 	- cfgr: CFGR value (only PLLSRC, PLLXTPRE and PLLMUL are used)
+ * @Return Value	- PLLCLK frequency
+ * Note				- NONE
  */
-uint32_t MCAL_RCC_GetSYSCLKFreq(void){
-	uint32_t sysClkFreq;
+static uint32_t RCC_Get_PLLFreq(uint32_t cfgr){
+	uint32_t pllIn, pllMul;
+
+	/* Bits 21:18 PLLMUL: 0000 --> x2 ... 1110 --> x16, 1111 --> x16 */
+	pllMul = ((cfgr & RCC_CFGR_PLLMUL_Msk) >> 18) + 2;
+	if(pllMul > 16)
+		pllMul = 16;
+
+	/* Bit 16 PLLSRC: 0 --> HSI / 2, 1 --> HSE (Bit 17 PLLXTPRE: HSE / 2) */
+	if(cfgr & RCC_CFGR_PLLSRC)
+		pllIn = (cfgr & RCC_CFGR_PLLXTPRE) ? (HSE_CLOCK >> 1) : HSE_CLOCK;
+	else
+		pllIn = HSI_RC_CLOCK >> 1;
+
+	return pllIn * pllMul;
+}
+
+/**===============================================================================================
+ * @FName			- RCC_Wait
+ * @Brief 			- Bounded wait until (reg & mask) == value
+ * @Parameter [in] 	- reg: register to poll
+ * @Parameter [in] 	- mask: bits to check
+ * @Parameter [in] 	- value: expected value of the masked bits
+ * @Parameter [in] 	- pTimer: running timeout
+ * @Return Value	- MCAL_OK, MCAL_TIMEOUT
+ * Note				- NONE
+ */
+static MCAL_Status_t RCC_Wait(volatile uint32_t *reg, uint32_t mask, uint32_t value, DWT_Timeout_t *pTimer){
+	while((*reg & mask) != value){
+		if(DWT_TIMEOUT_EXPIRED(*pTimer))
+			return MCAL_TIMEOUT;
+	}
+
+	return MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- RCC_Read_Clocks
+ * @Brief 			- Decodes the bus frequencies from RCC_CFGR
+ * @Parameter [out]	- pClocks: SYSCLK, HCLK, PCLK1 and PCLK2
+ * @Return Value	- NONE
+ * Note				- HSE frequency is the board constant HSE_CLOCK
+ */
+static void RCC_Read_Clocks(RCC_Clocks_t *pClocks){
+	uint32_t sysClkFreq = HSI_RC_CLOCK;
 	/*Bits 3:2 SWS: System clock switch status
 	Set and cleared by hardware to indicate which clock source is used as system clock.
 	00: HSI oscillator used as system clock
@@ -67,17 +154,44 @@ uint32_t MCAL_RCC_GetSYSCLKFreq(void){
 			sysClkFreq = HSI_RC_CLOCK;
 			break;
 		case 0b01:
-			/* TODO: you need to calculate it //HSE user should specify it */
 			sysClkFreq = HSE_CLOCK;
 			break;
 		case 0b10:
-			/* TODO: you need to calculate it PLLCLK & PLLMUL & PLL Source MUX user should specify it */
-			/* this needs calculations */
-			sysClkFreq = 16000000;
+			/* PLLCLK = PLL entry clock (HSI/2, HSE or HSE/2) * PLLMUL */
+			sysClkFreq = RCC_Get_PLLFreq(RCC->CFGR);
 			break;
 		default: /* Do Nothing */ break;
 	}
-	return sysClkFreq;
+
+	pClocks->SYSCLK_Freq = sysClkFreq;
+
+	/* Bits 7:4 HPRE: AHB prescaler */
+	pClocks->HCLK_Freq = sysClkFreq >> AHB_PrescTable[ (RCC->CFGR >> 4) & 0xF ];
+
+	/* Bits 10:8 PPRE1: APB low-speed prescaler (APB1) */
+	pClocks->PCLK1_Freq = pClocks->HCLK_Freq >> APB_PrescTable[ (RCC->CFGR >> 8) & 0b111 ];
+
+	/* Bits 13:11 PPRE2: APB high-speed prescaler (APB2) */
+	pClocks->PCLK2_Freq = pClocks->HCLK_Freq >> APB_PrescTable[ (RCC->CFGR >> 11) & 0b111 ];
+}
+
+/*******************************************************/
+
+/*******************************************************/
+/******* APIs Supported by "MCAL RCC DRIVER" ***********/
+/*******************************************************/
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_GetSYSCLKFreq
+ * @Brief 			- get SYSCLK bus Frequency
+ * @Return Value	- SYSCLK bus Frequency
+ * @Note			- HSE frequency is the board constant HSE_CLOCK
+ */
+uint32_t MCAL_RCC_GetSYSCLKFreq(void){
+	if(!Global_RCC_Clocks_Valid)
+		MCAL_RCC_UpdateClocks();
+
+	return Global_RCC_Clocks.SYSCLK_Freq;
 }
 
 /**===============================================================================================
@@ -86,8 +200,10 @@ uint32_t MCAL_RCC_GetSYSCLKFreq(void){
  * @Return Value	- AHB bus Frequency
  */
 uint32_t MCAL_RCC_GetHCLKFreq(void){
-	/* Bits 7:4 HPRE: AHB prescaler */
-	return ( MCAL_RCC_GetSYSCLKFreq() >> AHB_PrescTable[ (RCC->CFGR >> 4) & 0xF ] );
+	if(!Global_RCC_Clocks_Valid)
+		MCAL_RCC_UpdateClocks();
+
+	return Global_RCC_Clocks.HCLK_Freq;
 }
 
 /**===============================================================================================
@@ -96,8 +212,10 @@ uint32_t MCAL_RCC_GetHCLKFreq(void){
  * @Return Value	- APB1 bus Frequency
  */
 uint32_t MCAL_RCC_GetPCLK1Freq(void){
-	/* Bits 10:8 PPRE1: APB low-speed prescaler (APB1) */
-	return ( MCAL_RCC_GetHCLKFreq() >> APB_PrescTable[ (RCC->CFGR >> 8) & 0b111 ] );
+	if(!Global_RCC_Clocks_Valid)
+		MCAL_RCC_UpdateClocks();
+
+	return Global_RCC_Clocks.PCLK1_Freq;
 }
 
 /**===============================================================================================
@@ -106,8 +224,438 @@ uint32_t MCAL_RCC_GetPCLK1Freq(void){
  * @Return Value	- APB2 bus Frequency
  */
 uint32_t MCAL_RCC_GetPCLK2Freq(void){
-	/* Bits 13:11 PPRE2: APB high-speed prescaler (APB2) */
-	return ( MCAL_RCC_GetHCLKFreq() >> APB_PrescTable[ (RCC->CFGR >> 11) & 0b111 ] );
+	if(!Global_RCC_Clocks_Valid)
+		MCAL_RCC_UpdateClocks();
+
+	return Global_RCC_Clocks.PCLK2_Freq;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_GetClocks
+ * @Brief 			- get all bus Frequencies
+ * @Parameter [out]	- pClocks: SYSCLK, HCLK, PCLK1 and PCLK2
+ * @Return Value	- NONE
+ */
+void MCAL_RCC_GetClocks(RCC_Clocks_t *pClocks){
+	if(!Global_RCC_Clocks_Valid)
+		MCAL_RCC_UpdateClocks();
+
+	*pClocks = Global_RCC_Clocks;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_ClockConfig
+ * @Brief 			- Configures SYSCLK source, PLL, AHB / APB prescalers and the Flash wait states
+ * @Parameter [in] 	- RCC_Config: requested clock tree
+ * @Return Value	- MCAL_OK, MCAL_ERROR if a limit is exceeded (nothing changed),
+ * 					  MCAL_TIMEOUT if an oscillator / the PLL does not start (system left on its previous source or HSI)
+ * @Note			- 72 MHz from HSE_CLOCK = 16 MHz: PLL_Source = HSE_Div2, PLL_Mul = 9, APB1 = DIV2
+ * 					- 64 MHz from HSI: PLL_Source = HSI_Div2, PLL_Mul = 16, APB1 = DIV2
+ * 					- Limits: SYSCLK <= 72 MHz, PLL output 16..72 MHz, PCLK1 <= 36 MHz
+ * 					- A PLL already locked with the requested settings is reused without relocking
+ * 					- Subscribers (USART BRR, I2C CCR / TRISE, SPI prescaler) are updated right after the switch,
+ * 					  change the clocks while no transfer is ongoing
+ */
+MCAL_Status_t MCAL_RCC_ClockConfig(const RCC_Config_t *RCC_Config){
+	uint32_t sysClk, hclk, latency, oldPpre;
+	uint8_t useHSE = 0;
+	MCAL_Status_t status = MCAL_OK;
+	DWT_Timeout_t timer;
+
+	/* 1. Compute the new frequencies and check them against the device limits */
+	switch(RCC_Config->SYSCLK_Source){
+		case RCC_SYSCLK_Source_HSI:
+			sysClk = HSI_RC_CLOCK;
+			break;
+		case RCC_SYSCLK_Source_HSE:
+			sysClk = HSE_CLOCK;
+			useHSE = 1;
+			break;
+		case RCC_SYSCLK_Source_PLL:
+			sysClk = RCC_Get_PLLFreq(RCC_Config->PLL_Source | RCC_Config->PLL_Mul);
+			useHSE = (RCC_Config->PLL_Source != RCC_PLL_Source_HSI_Div2);
+			if(sysClk < 16000000)
+				return MCAL_ERROR;
+			break;
+		default:
+			return MCAL_ERROR;
+	}
+
+	if(sysClk > 72000000)
+		return MCAL_ERROR;
+
+	hclk = sysClk >> AHB_PrescTable[(RCC_Config->AHB_Prescaler >> 4) & 0xF];
+	if((hclk >> APB_PrescTable[RCC_Config->APB1_Prescaler & 0b111]) > 36000000)
+		return MCAL_ERROR;
+
+	/* 2. Flash wait states: 0 up to 24 MHz, 1 up to 48 MHz, 2 up to 72 MHz (raised before speeding up) */
+	latency = (sysClk <= 24000000) ? 0 : ((sysClk <= 48000000) ? 1 : 2);
+
+	FLASH->ACR |= FLASH_ACR_PRFTBE;
+	if(latency > (FLASH->ACR & FLASH_ACR_LATENCY_Msk))
+		FLASH->ACR = (FLASH->ACR & ~(FLASH_ACR_LATENCY_Msk)) | latency;
+
+	MCAL_DWT_Timeout_Start(&timer, RCC_TIMEOUT_DEFAULT);
+
+	/* 3. Start the needed oscillators (HSI is also the fallback while the PLL is reprogrammed) */
+	RCC->CR |= RCC_CR_HSION;
+	status = RCC_Wait(&RCC->CR, RCC_CR_HSIRDY, RCC_CR_HSIRDY, &timer);
+
+	if((status == MCAL_OK) && useHSE){
+		RCC->CR |= RCC_CR_HSEON;
+		status = RCC_Wait(&RCC->CR, RCC_CR_HSERDY, RCC_CR_HSERDY, &timer);
+	}
+
+	if(status != MCAL_OK)
+		return status;
+
+	/* 4. Slowest APB buses during the switch so none of them exceeds its limit */
+	oldPpre = RCC->CFGR & RCC_CFGR_PPRE_Msk;
+	RCC->CFGR |= RCC_CFGR_PPRE_Msk;
+
+	/* 5. PLL can only be reprogrammed while disabled, leave it first if it drives SYSCLK */
+	if( (RCC_Config->SYSCLK_Source == RCC_SYSCLK_Source_PLL) &&
+		!( (RCC->CR & RCC_CR_PLLRDY) &&
+		   ((RCC->CFGR & (RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMUL_Msk)) == (RCC_Config->PLL_Source | RCC_Config->PLL_Mul)) ) ){
+		if((RCC->CFGR & RCC_CFGR_SWS_Msk) == (RCC_SYSCLK_Source_PLL << 2)){
+			RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_SW_Msk)) | RCC_SYSCLK_Source_HSI;
+			status = RCC_Wait(&RCC->CFGR, RCC_CFGR_SWS_Msk, (RCC_SYSCLK_Source_HSI << 2), &timer);
+		}
+
+		if(status == MCAL_OK){
+			RCC->CR &= ~(RCC_CR_PLLON);
+			status = RCC_Wait(&RCC->CR, RCC_CR_PLLRDY, 0, &timer);
+		}
+
+		if(status == MCAL_OK){
+			RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMUL_Msk)) |
+						RCC_Config->PLL_Source | RCC_Config->PLL_Mul;
+			RCC->CR |= RCC_CR_PLLON;
+			status = RCC_Wait(&RCC->CR, RCC_CR_PLLRDY, RCC_CR_PLLRDY, &timer);
+		}
+	}
+
+	if(status != MCAL_OK){
+		RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_PPRE_Msk)) | oldPpre;
+		MCAL_RCC_UpdateClocks();
+		return status;
+	}
+
+	/* 6. AHB prescaler then clock switch */
+	RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_HPRE_Msk)) | RCC_Config->AHB_Prescaler;
+	RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_SW_Msk)) | RCC_Config->SYSCLK_Source;
+	status = RCC_Wait(&RCC->CFGR, RCC_CFGR_SWS_Msk, (RCC_Config->SYSCLK_Source << 2), &timer);
+
+	/* 7. Final APB prescalers */
+	RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_PPRE_Msk)) | (RCC_Config->APB1_Prescaler << 8) | (RCC_Config->APB2_Prescaler << 11);
+
+	if(status == MCAL_OK){
+		/* 8. Lower the wait states if the new SYSCLK allows it */
+		FLASH->ACR = (FLASH->ACR & ~(FLASH_ACR_LATENCY_Msk)) | latency;
+
+		/* 9. Stop the oscillators that are no longer used (the governor may keep the PLL locked) */
+		if((RCC_Config->SYSCLK_Source != RCC_SYSCLK_Source_PLL) && !(Global_RCC_Governor.enabled && Global_RCC_Governor.config.Keep_PLL))
+			RCC->CR &= ~(RCC_CR_PLLON);
+		if(!useHSE && !((RCC->CR & RCC_CR_PLLON) && (RCC->CFGR & RCC_CFGR_PLLSRC)))
+			RCC->CR &= ~(RCC_CR_HSEON);
+	}
+
+	/* 10. Refresh the snapshot and the drivers that depend on it */
+	MCAL_RCC_UpdateClocks();
+
+	return status;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_UpdateClocks
+ * @Brief 			- Re-reads the clock tree, notifies the subscribers if any frequency changed
+ * @Return Value	- NONE
+ * @Note			- Called by MCAL_RCC_ClockConfig(), call it after changing RCC_CFGR directly
+ * 					- Subscribers run in the order they subscribed, from the caller context
+ */
+void MCAL_RCC_UpdateClocks(void){
+	RCC_Clocks_t clocks;
+	uint8_t i;
+
+	RCC_Read_Clocks(&clocks);
+
+	if( Global_RCC_Clocks_Valid &&
+		(clocks.SYSCLK_Freq == Global_RCC_Clocks.SYSCLK_Freq) &&
+		(clocks.HCLK_Freq == Global_RCC_Clocks.HCLK_Freq) &&
+		(clocks.PCLK1_Freq == Global_RCC_Clocks.PCLK1_Freq) &&
+		(clocks.PCLK2_Freq == Global_RCC_Clocks.PCLK2_Freq) )
+		return;
+
+	Global_RCC_Clocks = clocks;
+	Global_RCC_Clocks_Valid = 1;
+
+	/* Timeouts are counted in HCLK cycles */
+	MCAL_DWT_Init();
+
+	for(i = 0; i < RCC_MAX_SUBSCRIBERS; i++){
+		if(Global_RCC_Subscribers[i] != NULL)
+			Global_RCC_Subscribers[i](&Global_RCC_Clocks);
+	}
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_Subscribe
+ * @Brief 			- Registers a function called after every change of the bus frequencies
+ * @Parameter [in] 	- P_ClockChange_CallBack: function to call
+ * @Return Value	- MCAL_OK (also if already registered), MCAL_ERROR if the list is full
+ * @Note			- NONE
+ */
+MCAL_Status_t MCAL_RCC_Subscribe(RCC_ClockChange_CallBack_t P_ClockChange_CallBack){
+	uint8_t i, freeSlot = RCC_MAX_SUBSCRIBERS;
+
+	for(i = 0; i < RCC_MAX_SUBSCRIBERS; i++){
+		if(Global_RCC_Subscribers[i] == P_ClockChange_CallBack)
+			return MCAL_OK;
+
+		if((Global_RCC_Subscribers[i] == NULL) && (freeSlot == RCC_MAX_SUBSCRIBERS))
+			freeSlot = i;
+	}
+
+	if(freeSlot == RCC_MAX_SUBSCRIBERS)
+		return MCAL_ERROR;
+
+	Global_RCC_Subscribers[freeSlot] = P_ClockChange_CallBack;
+
+	return MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_Unsubscribe
+ * @Brief 			- Removes a function registered by MCAL_RCC_Subscribe()
+ * @Parameter [in] 	- P_ClockChange_CallBack: function to remove
+ * @Return Value	- NONE
+ * @Note			- NONE
+ */
+void MCAL_RCC_Unsubscribe(RCC_ClockChange_CallBack_t P_ClockChange_CallBack){
+	uint8_t i;
+
+	for(i = 0; i < RCC_MAX_SUBSCRIBERS; i++){
+		if(Global_RCC_Subscribers[i] == P_ClockChange_CallBack)
+			Global_RCC_Subscribers[i] = NULL;
+	}
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_AddBusyQuery
+ * @Brief 			- Registers a function that can hold back the governor profile switches
+ * @Parameter [in] 	- P_Busy_CallBack: returns 1 while a clock change would break a transfer
+ * @Return Value	- MCAL_OK (also if already registered), MCAL_ERROR if the list is full
+ * @Note			- Only the governor asks, MCAL_RCC_ClockConfig() called directly is never held back
+ */
+MCAL_Status_t MCAL_RCC_AddBusyQuery(RCC_Busy_CallBack_t P_Busy_CallBack){
+	uint8_t i, freeSlot = RCC_MAX_BUSY_QUERIES;
+
+	for(i = 0; i < RCC_MAX_BUSY_QUERIES; i++){
+		if(Global_RCC_BusyQueries[i] == P_Busy_CallBack)
+			return MCAL_OK;
+
+		if((Global_RCC_BusyQueries[i] == NULL) && (freeSlot == RCC_MAX_BUSY_QUERIES))
+			freeSlot = i;
+	}
+
+	if(freeSlot == RCC_MAX_BUSY_QUERIES)
+		return MCAL_ERROR;
+
+	Global_RCC_BusyQueries[freeSlot] = P_Busy_CallBack;
+
+	return MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_RemoveBusyQuery
+ * @Brief 			- Removes a function registered by MCAL_RCC_AddBusyQuery()
+ * @Parameter [in] 	- P_Busy_CallBack: function to remove
+ * @Return Value	- NONE
+ * @Note			- NONE
+ */
+void MCAL_RCC_RemoveBusyQuery(RCC_Busy_CallBack_t P_Busy_CallBack){
+	uint8_t i;
+
+	for(i = 0; i < RCC_MAX_BUSY_QUERIES; i++){
+		if(Global_RCC_BusyQueries[i] == P_Busy_CallBack)
+			Global_RCC_BusyQueries[i] = NULL;
+	}
+}
+
+/**===============================================================================================
+ * @FName			- RCC_Governor_Switch
+ * @Brief 			- Applies a governor profile unless another switch is in progress or a peripheral is busy
+ * @Parameter [in] 	- profile: index in pProfiles
+ * @Return Value	- MCAL_OK, MCAL_BUSY (interrupted a switch or held back by a busy query,
+ * 					  target kept for the next idle), ClockConfig status
+ * Note				- A transfer started from an interrupt after the busy queries is not covered
+ */
+static MCAL_Status_t RCC_Governor_Switch(uint8_t profile){
+	RCC_Governor_t *gov = &Global_RCC_Governor;
+	MCAL_Status_t status;
+	uint8_t i;
+
+	if(gov->switching)
+		return MCAL_BUSY;
+
+	for(i = 0; i < RCC_MAX_BUSY_QUERIES; i++){
+		if((Global_RCC_BusyQueries[i] != NULL) && Global_RCC_BusyQueries[i]())
+			return MCAL_BUSY;
+	}
+
+	gov->switching = 1;
+	status = MCAL_RCC_ClockConfig(&gov->config.pProfiles[profile]);
+	if(status == MCAL_OK)
+		gov->profile = profile;
+	gov->switching = 0;
+
+	return status;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_Governor_Init
+ * @Brief 			- Starts the frequency governor on the fastest profile
+ * @Parameter [in] 	- Governor_Config: profiles, measurement window and idle thresholds
+ * @Return Value	- MCAL_OK, MCAL_ERROR (bad configuration), MCAL_TIMEOUT (fastest profile did not start)
+ * @Note			- Typical use: 1 ms tick, 100 ticks window, down at 70 % idle, up below 30 % idle
+ * 					- Profiles are applied with MCAL_RCC_ClockConfig(), so USART / I2C / SPI follow every switch
+ * 					- A switch is deferred while a busy query (MCAL_RCC_AddBusyQuery()) reports a transfer,
+ * 					  e.g. a USART TX, and retried by the next MCAL_RCC_Governor_Idle()
+ * 					- Continuous receivers (USART RX ring buffer / ReceiveToIdle_DMA) never report busy,
+ * 					  characters arriving during a switch can be lost or corrupted
+ */
+MCAL_Status_t MCAL_RCC_Governor_Init(const RCC_Governor_Config_t *Governor_Config){
+	MCAL_Status_t status;
+
+	if( (Governor_Config->pProfiles == NULL) || (Governor_Config->Profiles_Count == 0) ||
+		(Governor_Config->Window_Ticks == 0) || (Governor_Config->Idle_Down_Percent > 100) ||
+		(Governor_Config->Idle_Up_Percent >= Governor_Config->Idle_Down_Percent) )
+		return MCAL_ERROR;
+
+	Global_RCC_Governor.enabled = 0;
+	Global_RCC_Governor.config = *Governor_Config;
+	Global_RCC_Governor.ticks = 0;
+	Global_RCC_Governor.idleTicks = 0;
+	Global_RCC_Governor.inIdle = 0;
+	Global_RCC_Governor.switching = 0;
+	Global_RCC_Governor.idlePercent = 0;
+	Global_RCC_Governor.profile = 0;
+	Global_RCC_Governor.target = 0;
+
+	status = MCAL_RCC_ClockConfig(&Governor_Config->pProfiles[0]);
+
+	if(status == MCAL_OK)
+		Global_RCC_Governor.enabled = 1;
+
+	return status;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_Governor_Tick
+ * @Brief 			- Samples the idle state and decides the profile at the end of every window
+ * @Return Value	- NONE
+ * @Note			- Call it from a periodic interrupt (timer / SysTick), it only counts:
+ * 					  the switch itself is done later by MCAL_RCC_Governor_Idle()
+ * 					- A tick derived from HCLK (SysTick) gets slower in the slow profiles,
+ * 					  the idle percentage stays right but the window gets longer
+ */
+void MCAL_RCC_Governor_Tick(void){
+	RCC_Governor_t *gov = &Global_RCC_Governor;
+
+	if(!gov->enabled)
+		return;
+
+	gov->ticks++;
+	if(gov->inIdle)
+		gov->idleTicks++;
+
+	if(gov->ticks < gov->config.Window_Ticks)
+		return;
+
+	gov->idlePercent = (uint8_t)(((uint32_t)gov->idleTicks * 100) / gov->ticks);
+	gov->ticks = 0;
+	gov->idleTicks = 0;
+
+	if(gov->idlePercent < gov->config.Idle_Up_Percent){
+		/* Load came back: full speed in one step */
+		gov->target = 0;
+	}
+	else if((gov->idlePercent >= gov->config.Idle_Down_Percent) && (gov->profile < (gov->config.Profiles_Count - 1))){
+		/* Mostly idle: one step slower per window */
+		gov->target = gov->profile + 1;
+	}
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_Governor_Idle
+ * @Brief 			- Applies the pending profile then sleeps until the next interrupt
+ * @Return Value	- NONE
+ * @Note			- Replaces the WFI of the application idle loop, the time spent here is the idle time
+ * 					- A switch held back by a busy peripheral is retried on every call
+ */
+void MCAL_RCC_Governor_Idle(void){
+	RCC_Governor_t *gov = &Global_RCC_Governor;
+	uint8_t target = gov->target;
+	MCAL_Status_t status;
+
+	/* A boost may change the target while switching, follow it before sleeping */
+	while(gov->enabled && (target != gov->profile)){
+		status = RCC_Governor_Switch(target);
+		if(status == MCAL_BUSY)
+			break;	/* deferred, the target is kept for the next idle */
+		if(status != MCAL_OK){
+			gov->target = gov->profile;
+			break;
+		}
+		target = gov->target;
+	}
+
+	gov->inIdle = 1;
+	__asm volatile ("wfi");
+	gov->inIdle = 0;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_Governor_Boost
+ * @Brief 			- Switches to the fastest profile now and restarts the measurement window
+ * @Return Value	- MCAL_OK, MCAL_ERROR (governor not started), MCAL_TIMEOUT (PLL / HSE did not start),
+ * 					  MCAL_BUSY (interrupted a switch or a peripheral is busy, done by the next MCAL_RCC_Governor_Idle())
+ * @Note			- Call it when a burst of work arrives (also from an interrupt), the latency is
+ * 					  the HSE start-up + PLL lock time, or only a clock switch with Keep_PLL enabled
+ */
+MCAL_Status_t MCAL_RCC_Governor_Boost(void){
+	RCC_Governor_t *gov = &Global_RCC_Governor;
+	MCAL_Status_t status = MCAL_OK;
+
+	if(!gov->enabled)
+		return MCAL_ERROR;
+
+	gov->target = 0;
+	gov->ticks = 0;
+	gov->idleTicks = 0;
+
+	if(gov->profile != 0)
+		status = RCC_Governor_Switch(0);
+
+	return status;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_Governor_GetProfile
+ * @Brief 			- get the running profile
+ * @Return Value	- index in pProfiles (0 --> fastest)
+ */
+uint8_t MCAL_RCC_Governor_GetProfile(void){
+	return Global_RCC_Governor.profile;
+}
+
+/**===============================================================================================
+ * @FName			- MCAL_RCC_Governor_GetIdlePercent
+ * @Brief 			- get the idle percentage measured over the last window
+ * @Return Value	- 0..100
+ */
+uint8_t MCAL_RCC_Governor_GetIdlePercent(void){
+	return Global_RCC_Governor.idlePercent;
 }
 
 /*******************************************************/
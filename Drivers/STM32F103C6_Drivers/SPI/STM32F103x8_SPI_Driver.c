@@ -23,6 +23,53 @@ static SPI_Config_t *Global_SPI_Config[2] = {NULL, NULL};
 static SPI_Config_t Global_SPI1_Config;
 static SPI_Config_t Global_SPI2_Config;
 
+/* SCK frequency set at Init, kept on clock changes */
+static uint32_t Global_SPI_SCK_Freq[2] = {0, 0};
+
+/* 1: a clock change arrived during a DMA transfer, BR is reprogrammed when it ends */
+static volatile uint8_t Global_SPI_Retime_Pending[2] = {0, 0};
+
+/* DMA transfer / stream state of each SPI */
+typedef struct{
+	volatile uint8_t busy;
+	uint8_t stream;			/* 1: circular ping-pong streaming */
+	uint8_t useRx;			/* RX channel running (completion is taken from RX, it ends last) */
+	uint8_t checkCrc;		/* received CRC is checked at the end (a RX buffer was given) */
+	uint8_t packed;			/* DFF switched to 16-bit for the transfer, 8-bit restored at the end */
+	uint16_t txDummy;		/* TX source when no TX buffer is given */
+	uint16_t rxSink;		/* RX destination when no RX buffer is given */
+	void (* P_Done_CallBack)(MCAL_Status_t status);
+	void (* P_Half_CallBack)(uint8_t half);
+} SPI_DMA_t;
+
+static SPI_DMA_t Global_SPI_DMA[2];
+
+static DMA_Channel_TypeDef * const Global_SPI_DMA_TxChannel[2] = {DMA_Request_SPI1_TX, DMA_Request_SPI2_TX};
+static DMA_Channel_TypeDef * const Global_SPI_DMA_RxChannel[2] = {DMA_Request_SPI1_RX, DMA_Request_SPI2_RX};
+
+/* Bus manager state of each SPI */
+typedef struct{
+	SPI_Transaction_t *queue[SPI_BUS_QUEUE_SIZE];
+	volatile uint8_t head;				/* next transaction to run (DMA interrupt side) */
+	volatile uint8_t tail;				/* next free slot (MCAL_SPI_Bus_Submit side) */
+	volatile uint8_t running;
+	const SPI_Device_t *pCurrent;		/* device whose settings are in CR1 */
+} SPI_Bus_t;
+
+static SPI_Bus_t Global_SPI_Bus[2];
+
+/* Slave engine state of each SPI */
+typedef struct{
+	SPI_Slave_Config_t config;
+	const void *pNextTx;				/* response armed at the next NSS rising edge */
+	uint16_t nextTxLength;
+	uint16_t readIndex;					/* next ring frame returned by MCAL_SPI_Slave_Read() */
+	uint16_t selectIndex;				/* ring write index at the NSS falling edge */
+	volatile uint8_t running;
+} SPI_Slave_t;
+
+static SPI_Slave_t Global_SPI_Slave[2];
+
 /*******************************************************/
 
 /*******************************************************/
@@ -33,6 +80,649 @@ static SPI_Config_t Global_SPI2_Config;
 
 #define SPI_SR_TXE									(uint8_t)(0x02)                   // Transmit buffer empty
 #define SPI_SR_RXNE									(uint8_t)(0x01)                   // Receive buffer NOT empty
+#define SPI_SR_CRCERR								(uint8_t)(0x10)                   // CRC error flag
+#define SPI_SR_OVR									(uint8_t)(0x40)                   // Overrun flag
+#define SPI_SR_BSY									(uint8_t)(0x80)                   // Busy flag
+
+#define SPI_CR1_LSBFIRST							(uint16_t)(0x1U << 7)             // Bit 7 LSBFIRST: Frame format
+#define SPI_CR1_DFF									(uint16_t)(0x1U << 11)            // Bit 11 DFF: Data frame format
+#define SPI_CR1_CRCNEXT								(uint16_t)(0x1U << 12)            // Bit 12 CRCNEXT: CRC transfer next
+#define SPI_CR1_CRCEN								(uint16_t)(0x1U << 13)            // Bit 13 CRCEN: Hardware CRC calculation enable
+
+#define SPI_CR2_RXDMAEN								(uint16_t)(0x1U << 0)             // Bit 0 RXDMAEN: Rx buffer DMA enable
+#define SPI_CR2_TXDMAEN								(uint16_t)(0x1U << 1)             // Bit 1 TXDMAEN: Tx buffer DMA enable
+
+#define SPI_CR1_BR_Msk								(uint16_t)(0b111U << 3)           // Bits 5:3 BR[2:0]: Baud rate control
+#define SPI_CR1_SPE_Pos								6U
+#define SPI_CR1_SPE									(uint16_t)(0x1U << SPI_CR1_SPE_Pos) // Bit 6 SPE: SPI enable
+/* Settings owned by a bus device: CPHA, CPOL, BR, LSBFIRST, DFF */
+#define SPI_CR1_DEVICE_Msk							(uint16_t)((0x1U << 0) | (0x1U << 1) | SPI_CR1_BR_Msk | SPI_CR1_LSBFIRST | SPI_CR1_DFF)
+
+/*******************************************************/
+
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
+/**===============================================================================================
+ * @FName			- SPI_Get_BR
+ * @Brief 			- Smallest prescaler whose SCK does not exceed the requested frequency
+ * @Parameter [in] 	- pclk: APB frequency of the SPI
+ * @Parameter [in] 	- sck: requested SCK frequency
+ * @Return Value	- BR[2:0] already shifted (@ref SPI_CLK_Frequency_define), /256 if sck is too low
+ * Note				- SCK = PCLK / 2^(BR + 1)
+ */
+static uint16_t SPI_Get_BR(uint32_t pclk, uint32_t sck){
+	uint16_t br = 0;
+
+	while((br < 7) && ((pclk >> (br + 1)) > sck))
+		br++;
+
+	return (uint16_t)(br << 3);
+}
+
+/**===============================================================================================
+ * @FName			- SPI_Retime
+ * @Brief 			- Picks the prescaler closest to (not above) the kept SCK, or defers it during a DMA transfer
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Parameter [in] 	- SPIx: SPI instance of this index
+ * @Return Value	- NONE
+ * Note				- BR[2:0] must not be changed while a transfer is ongoing: the last frame is let out
+ * 					  first (BSY = 0) and BR is written with SPE = 0, as in SPI_Set_DFF()
+ * 					- A deferred retime runs from SPI_DMA_Stop(), a slave does not use BR
+ */
+static void SPI_Retime(uint8_t index, SPI_Typedef *SPIx){
+	DWT_Timeout_t timer;
+	uint32_t pclk;
+	uint16_t br;
+
+	if(Global_SPI_DMA[index].busy){
+		Global_SPI_Retime_Pending[index] = 1;
+		return;
+	}
+
+	Global_SPI_Retime_Pending[index] = 0;
+
+	if(!(SPIx->CR1 & SPI_Device_Mode_Master))
+		return;
+
+	pclk = (index == SPI1_Index) ? MCAL_RCC_GetPCLK2Freq() : MCAL_RCC_GetPCLK1Freq();
+	br = SPI_Get_BR(pclk, Global_SPI_SCK_Freq[index]);
+
+	if((SPIx->CR1 & SPI_CR1_BR_Msk) == br)
+		return;
+
+	MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+	while((SPIx->SR & SPI_SR_BSY) && !DWT_TIMEOUT_EXPIRED(timer));
+
+	BITBAND_PERIPH(SPIx->CR1, SPI_CR1_SPE_Pos) = 0;
+	SPIx->CR1 = (SPIx->CR1 & ~(SPI_CR1_BR_Msk)) | br;
+	BITBAND_PERIPH(SPIx->CR1, SPI_CR1_SPE_Pos) = 1;
+}
+
+/**===============================================================================================
+ * @FName			- SPI_ClockChange_CallBack
+ * @Brief 			- Keeps the Init SCK of every initialized SPI after a clock change
+ * @Parameter [in] 	- pClocks: new bus frequencies
+ * @Return Value	- NONE
+ * Note				- Subscribed to the RCC driver by MCAL_SPI_Init()
+ * 					- PCLK2 For SPI1, PCLK1 For SPI2, SCK = PCLK / 2^(BR + 1)
+ */
+static void SPI_ClockChange_CallBack(const RCC_Clocks_t *pClocks){
+	SPI_Typedef * const SPIx[2] = {SPI1, SPI2};
+	uint8_t index;
+
+	(void)pClocks;
+
+	for(index = 0; index < 2; index++){
+		if(Global_SPI_Config[index] == NULL)
+			continue;
+
+		SPI_Retime(index, SPIx[index]);
+	}
+}
+
+/**===============================================================================================
+ * @FName			- SPI_CRC_Reset
+ * @Brief 			- Starts a new CRC block: clears TXCRCR / RXCRCR, CRCNEXT and CRCERR
+ * @Parameter [in] 	- SPIx: where x is (1,2)
+ * @Return Value	- NONE
+ * Note				- Does nothing without CRCEN, CRCEN can only be toggled while SPE = 0
+ */
+static void SPI_CRC_Reset(SPI_Typedef *SPIx){
+	if(!(SPIx->CR1 & SPI_CR1_CRCEN))
+		return;
+
+	BITBAND_PERIPH(SPIx->CR1, SPI_CR1_SPE_Pos) = 0;
+	SPIx->CR1 &= ~(SPI_CR1_CRCEN | SPI_CR1_CRCNEXT);
+	SPIx->CR1 |= SPI_CR1_CRCEN;
+	BITBAND_PERIPH(SPIx->CR1, SPI_CR1_SPE_Pos) = 1;
+
+	/* CRCERR is cleared by writing 0 */
+	SPIx->SR &= ~(SPI_SR_CRCERR);
+}
+
+/**===============================================================================================
+ * @FName			- SPI_CRC_Check
+ * @Brief 			- Result of the CRC block once the CRC frame is received
+ * @Parameter [in] 	- SPIx: where x is (1,2)
+ * @Return Value	- MCAL_OK, MCAL_ERROR if the received CRC does not match RXCRCR (CRCERR)
+ * Note				- CRCERR is cleared
+ */
+static MCAL_Status_t SPI_CRC_Check(SPI_Typedef *SPIx){
+	if(SPIx->SR & SPI_SR_CRCERR){
+		SPIx->SR &= ~(SPI_SR_CRCERR);
+		return MCAL_ERROR;
+	}
+
+	return MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- SPI_Transfer
+ * @Brief 			- Full duplex block transfer core of MCAL_SPI_Transfer() and MCAL_SPI_Transfer_Packed()
+ * @Parameter [in] 	- SPIx: where x is (1,2)
+ * @Parameter [in] 	- pTxBuffer: frames to send (NULL: SPI_DUMMY_FRAME is sent)
+ * @Parameter [out] - pRxBuffer: received frames (NULL: discarded)
+ * @Parameter [in] 	- length: number of frames
+ * @Parameter [in] 	- swap: 1 to exchange the two bytes of every 16-bit frame (both directions)
+ * @Return Value	- see MCAL_SPI_Transfer()
+ * Note				- NONE
+ */
+static MCAL_Status_t SPI_Transfer(SPI_Typedef *SPIx, const void *pTxBuffer, void *pRxBuffer, size_t length, uint8_t swap){
+	const uint8_t *pTx8 = pTxBuffer;
+	const uint16_t *pTx16 = pTxBuffer;
+	uint8_t *pRx8 = pRxBuffer;
+	uint16_t *pRx16 = pRxBuffer;
+	uint8_t is16Bit = (SPIx->CR1 & SPI_CR1_DFF) ? 1 : 0;
+	uint8_t crc = (SPIx->CR1 & SPI_CR1_CRCEN) ? 1 : 0;
+	size_t txCount = 0, rxCount = 0;
+	uint16_t frame;
+	DWT_Timeout_t timer;
+
+	/* Nothing to clock, CRCNEXT would never be set for an empty block */
+	if(length == 0)
+		return MCAL_OK;
+
+	SPI_CRC_Reset(SPIx);
+	MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+
+	/* The CRC frame is received after the data frames */
+	while(rxCount < (length + crc)){
+		/* Prime TX while the previous frame is still shifting */
+		if((txCount < length) && ((txCount - rxCount) < 2) && (SPIx->SR & SPI_SR_TXE)){
+			if(pTxBuffer == NULL)
+				frame = SPI_DUMMY_FRAME;
+			else
+				frame = is16Bit ? pTx16[txCount] : pTx8[txCount];
+
+			if(swap)
+				frame = (uint16_t)((frame << 8) | (frame >> 8));
+
+			SPIx->DR = frame;
+			txCount++;
+
+			/* Right after the last data frame is written */
+			if(crc && (txCount == length))
+				SPIx->CR1 |= SPI_CR1_CRCNEXT;
+
+			DWT_TIMEOUT_RESTART(timer);
+		}
+
+		if(SPIx->SR & SPI_SR_RXNE){
+			frame = SPIx->DR;
+
+			if(swap)
+				frame = (uint16_t)((frame << 8) | (frame >> 8));
+
+			if((pRxBuffer != NULL) && (rxCount < length)){
+				if(is16Bit)
+					pRx16[rxCount] = frame;
+				else
+					pRx8[rxCount] = (uint8_t)frame;
+			}
+
+			rxCount++;
+			DWT_TIMEOUT_RESTART(timer);
+		}
+		else if(DWT_TIMEOUT_EXPIRED(timer)){
+			return MCAL_TIMEOUT;
+		}
+	}
+
+	return crc ? SPI_CRC_Check(SPIx) : MCAL_OK;
+}
+
+/**===============================================================================================
+ * @FName			- SPI_Set_DFF
+ * @Brief 			- Changes the frame size between two transfers
+ * @Parameter [in] 	- SPIx: where x is (1,2)
+ * @Parameter [in] 	- dff: SPI_Data_Size_8bits or SPI_Data_Size_16bits
+ * @Return Value	- NONE
+ * Note				- DFF can only be written while SPE = 0, the last frame is let out first (BSY = 0)
+ */
+static void SPI_Set_DFF(SPI_Typedef *SPIx, uint16_t dff){
+	DWT_Timeout_t timer;
+
+	if((SPIx->CR1 & SPI_CR1_DFF) == dff)
+		return;
+
+	MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+	while((SPIx->SR & SPI_SR_BSY) && !DWT_TIMEOUT_EXPIRED(timer));
+
+	BITBAND_PERIPH(SPIx->CR1, SPI_CR1_SPE_Pos) = 0;
+	SPIx->CR1 = (SPIx->CR1 & ~(SPI_CR1_DFF)) | dff;
+	BITBAND_PERIPH(SPIx->CR1, SPI_CR1_SPE_Pos) = 1;
+}
+
+/**===============================================================================================
+ * @FName			- SPI_DMA_Stop
+ * @Brief 			- Stops the DMA channels of an SPI and gives them back
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Parameter [in] 	- SPIx: SPI instance of this index
+ * @Return Value	- NONE
+ * Note				- NONE
+ */
+static void SPI_DMA_Stop(uint8_t index, SPI_Typedef *SPIx){
+	SPI_DMA_t *dma = &Global_SPI_DMA[index];
+
+	SPIx->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+
+	MCAL_DMA_Stop(Global_SPI_DMA_TxChannel[index]);
+	MCAL_DMA_Release(Global_SPI_DMA_TxChannel[index], SPIx);
+
+	if(dma->useRx){
+		MCAL_DMA_Stop(Global_SPI_DMA_RxChannel[index]);
+		MCAL_DMA_Release(Global_SPI_DMA_RxChannel[index], SPIx);
+	}
+
+	if(dma->packed){
+		dma->packed = 0;
+		SPI_Set_DFF(SPIx, SPI_Data_Size_8bits);
+	}
+
+	dma->busy = 0;
+
+	/* Clock change received during the transfer */
+	if(Global_SPI_Retime_Pending[index])
+		SPI_Retime(index, SPIx);
+}
+
+/**===============================================================================================
+ * @FName			- SPI_DMA_Handler
+ * @Brief 			- Common DMA interrupt handling of the SPI channels
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Parameter [in] 	- SPIx: SPI instance of this index
+ * @Parameter [in] 	- irq_src: DMA interrupt source
+ * @Return Value	- NONE
+ * Note				- Called from the DMA interrupt, only the channel that ends last has HT / TC enabled
+ */
+static void SPI_DMA_Handler(uint8_t index, SPI_Typedef *SPIx, struct S_DMA_IRQ_SRC irq_src){
+	SPI_DMA_t *dma = &Global_SPI_DMA[index];
+	void (* P_Done_CallBack)(MCAL_Status_t status) = dma->P_Done_CallBack;
+	MCAL_Status_t status = MCAL_OK;
+	DWT_Timeout_t timer;
+
+	if(irq_src.TE){
+		SPI_DMA_Stop(index, SPIx);
+		if(dma->stream){
+			dma->stream = 0;
+			dma->P_Half_CallBack(SPI_Stream_Error);
+		}
+		else if(P_Done_CallBack != NULL){
+			P_Done_CallBack(MCAL_ERROR);
+		}
+		return;
+	}
+
+	if(dma->stream){
+		/* HT: first half done, the application refills it while the second half is on the wire */
+		if(irq_src.HT)
+			dma->P_Half_CallBack(SPI_Stream_Half_First);
+		if(irq_src.TC)
+			dma->P_Half_CallBack(SPI_Stream_Half_Second);
+	}
+	else if(irq_src.TC){
+		SPI_DMA_Stop(index, SPIx);
+
+		if(SPIx->CR1 & SPI_CR1_CRCEN){
+			/* The SPI sends TXCRCR after the last DMA frame, the CRC frame that follows is read here */
+			MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+			while(!(SPIx->SR & SPI_SR_RXNE) && !DWT_TIMEOUT_EXPIRED(timer));
+
+			if(!(SPIx->SR & SPI_SR_RXNE)){
+				status = MCAL_TIMEOUT;
+			}
+			else{
+				(void)SPIx->DR;
+
+				status = SPI_CRC_Check(SPIx);
+				if(!dma->checkCrc)
+					status = MCAL_OK;
+			}
+		}
+
+		if(P_Done_CallBack != NULL)
+			P_Done_CallBack(status);
+	}
+}
+
+static void SPI1_DMA_CallBack(struct S_DMA_IRQ_SRC irq_src){
+	SPI_DMA_Handler(SPI1_Index, SPI1, irq_src);
+}
+
+static void SPI2_DMA_CallBack(struct S_DMA_IRQ_SRC irq_src){
+	SPI_DMA_Handler(SPI2_Index, SPI2, irq_src);
+}
+
+/**===============================================================================================
+ * @FName			- SPI_DMA_Start
+ * @Brief 			- Claims, configures and starts the SPI DMA channels
+ * @Parameter [in] 	- SPIx: where x is (1,2)
+ * @Parameter [in] 	- pTxBuffer: frames to send (NULL: SPI_DUMMY_FRAME)
+ * @Parameter [in] 	- pRxBuffer: received frames (NULL: discarded, in stream mode the RX channel is not used)
+ * @Parameter [in] 	- length: number of frames
+ * @Parameter [in] 	- mode: DMA_Mode_Normal (one block) or DMA_Mode_Circular (stream)
+ * @Return Value	- MCAL_OK, MCAL_BUSY (transfer running or channel claimed), MCAL_ERROR (wrong parameters)
+ * Note				- RX is armed before TX so the first received frame is never missed
+ */
+static MCAL_Status_t SPI_DMA_Start(SPI_Typedef *SPIx, const void *pTxBuffer, void *pRxBuffer, uint16_t length, uint32_t mode){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+	SPI_DMA_t *dma = &Global_SPI_DMA[index];
+	DMA_Config_t DMA_Cfg;
+	uint32_t irqLast;
+
+	if((length == 0) || (Global_SPI_Config[index] == NULL))
+		return MCAL_ERROR;
+
+	if(dma->busy)
+		return MCAL_BUSY;
+
+	/* The CRC frame only ends a block */
+	if((mode == DMA_Mode_Circular) && (SPIx->CR1 & SPI_CR1_CRCEN))
+		return MCAL_ERROR;
+
+	/* Circular without RX buffer: TX alone, the RX overrun does not stop a master */
+	dma->useRx = ((mode == DMA_Mode_Normal) || (pRxBuffer != NULL)) ? 1 : 0;
+
+	if(MCAL_DMA_Claim(Global_SPI_DMA_TxChannel[index], SPIx) != MCAL_OK)
+		return MCAL_BUSY;
+
+	if(dma->useRx && (MCAL_DMA_Claim(Global_SPI_DMA_RxChannel[index], SPIx) != MCAL_OK)){
+		MCAL_DMA_Release(Global_SPI_DMA_TxChannel[index], SPIx);
+		return MCAL_BUSY;
+	}
+
+	dma->busy = 1;
+	dma->stream = (mode == DMA_Mode_Circular) ? 1 : 0;
+	dma->txDummy = SPI_DUMMY_FRAME;
+	dma->checkCrc = (pRxBuffer != NULL) ? 1 : 0;
+
+	/* With CRCEN the counters hold data frames only, the CRC frame is sent by the SPI after TX TC */
+	SPI_CRC_Reset(SPIx);
+
+	if(SPIx->CR1 & SPI_CR1_DFF){
+		DMA_Cfg.periphSize = DMA_PeriphSize_16bits;
+		DMA_Cfg.memSize = DMA_MemSize_16bits;
+	}
+	else{
+		DMA_Cfg.periphSize = DMA_PeriphSize_8bits;
+		DMA_Cfg.memSize = DMA_MemSize_8bits;
+	}
+	DMA_Cfg.periphInc = DMA_PeriphInc_Disable;
+	DMA_Cfg.mode = mode;
+	DMA_Cfg.P_IRQ_CallBack = (index == SPI1_Index) ? SPI1_DMA_CallBack : SPI2_DMA_CallBack;
+
+	/* The channel that ends last reports the progress */
+	irqLast = DMA_IRQ_TC | DMA_IRQ_TE | (dma->stream ? DMA_IRQ_HT : DMA_IRQ_NONE);
+
+	if(dma->useRx){
+		/* SPIx->DR --> pRxBuffer (or the sink, not incremented), higher priority than TX to avoid overrun */
+		DMA_Cfg.direction = DMA_Direction_PeriphToMem;
+		DMA_Cfg.priority = DMA_Priority_VeryHigh;
+		DMA_Cfg.memInc = (pRxBuffer != NULL) ? DMA_MemInc_Enable : DMA_MemInc_Disable;
+		DMA_Cfg.IRQ_EN = irqLast;
+		MCAL_DMA_Init(Global_SPI_DMA_RxChannel[index], &DMA_Cfg);
+		MCAL_DMA_Start(Global_SPI_DMA_RxChannel[index], (uint32_t)&SPIx->DR,
+				(pRxBuffer != NULL) ? (uint32_t)pRxBuffer : (uint32_t)&dma->rxSink, length);
+
+		/* Drop a stale frame, then let RXNE drive the channel */
+		(void)SPIx->DR;
+		SPIx->CR2 |= SPI_CR2_RXDMAEN;
+	}
+
+	/* pTxBuffer (or the dummy frame, not incremented) --> SPIx->DR */
+	DMA_Cfg.direction = DMA_Direction_MemToPeriph;
+	DMA_Cfg.priority = DMA_Priority_High;
+	DMA_Cfg.memInc = (pTxBuffer != NULL) ? DMA_MemInc_Enable : DMA_MemInc_Disable;
+	DMA_Cfg.IRQ_EN = dma->useRx ? DMA_IRQ_TE : irqLast;
+	MCAL_DMA_Init(Global_SPI_DMA_TxChannel[index], &DMA_Cfg);
+	MCAL_DMA_Start(Global_SPI_DMA_TxChannel[index], (uint32_t)&SPIx->DR,
+			(pTxBuffer != NULL) ? (uint32_t)pTxBuffer : (uint32_t)&dma->txDummy, length);
+
+	SPIx->CR2 |= SPI_CR2_TXDMAEN;
+
+	return MCAL_OK;
+}
+
+static void SPI_Bus_Next(uint8_t index, SPI_Typedef *SPIx);
+
+/**===============================================================================================
+ * @FName			- SPI_Bus_Done
+ * @Brief 			- Ends the running bus transaction and starts the next one
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Parameter [in] 	- SPIx: SPI instance of this index
+ * @Parameter [in] 	- status: result passed to the transaction callback
+ * Note				- Called from the DMA interrupt (or from SPI_Bus_Next() if the start failed)
+ */
+static void SPI_Bus_Done(uint8_t index, SPI_Typedef *SPIx, MCAL_Status_t status){
+	SPI_Bus_t *bus = &Global_SPI_Bus[index];
+	SPI_Transaction_t *pTransaction = bus->queue[bus->head & (SPI_BUS_QUEUE_SIZE - 1)];
+	DWT_Timeout_t timer;
+
+	/* RX TC comes with the last frame, BSY drops a few PCLK later: release CS after it */
+	MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+	while((SPIx->SR & SPI_SR_BSY) && !DWT_TIMEOUT_EXPIRED(timer));
+
+	MCAL_GPIO_WritePin(pTransaction->pDevice->CS_Port, pTransaction->pDevice->CS_Pin, GPIO_PIN_SET);
+
+	bus->head++;
+
+	if(pTransaction->P_Done_CallBack != NULL)
+		pTransaction->P_Done_CallBack(pTransaction, status);
+
+	SPI_Bus_Next(index, SPIx);
+}
+
+static void SPI1_Bus_CallBack(MCAL_Status_t status){
+	SPI_Bus_Done(SPI1_Index, SPI1, status);
+}
+
+static void SPI2_Bus_CallBack(MCAL_Status_t status){
+	SPI_Bus_Done(SPI2_Index, SPI2, status);
+}
+
+/**===============================================================================================
+ * @FName			- SPI_Bus_Next
+ * @Brief 			- Runs the transaction at the head of the queue, the bus goes idle if it is empty
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Parameter [in] 	- SPIx: SPI instance of this index
+ * @Return Value	- NONE
+ * Note				- CR1 is only rewritten when the device changes
+ */
+static void SPI_Bus_Next(uint8_t index, SPI_Typedef *SPIx){
+	SPI_Bus_t *bus = &Global_SPI_Bus[index];
+	SPI_Transaction_t *pTransaction;
+	const SPI_Device_t *pDevice;
+	uint32_t pclk;
+	MCAL_Status_t status;
+
+	if(bus->head == bus->tail){
+		bus->running = 0;
+		return;
+	}
+
+	bus->running = 1;
+	pTransaction = bus->queue[bus->head & (SPI_BUS_QUEUE_SIZE - 1)];
+	pDevice = pTransaction->pDevice;
+
+	if(pDevice != bus->pCurrent){
+		/* DFF can only be written while SPE = 0 */
+		pclk = (index == SPI1_Index) ? MCAL_RCC_GetPCLK2Freq() : MCAL_RCC_GetPCLK1Freq();
+		BITBAND_PERIPH(SPIx->CR1, SPI_CR1_SPE_Pos) = 0;
+		SPIx->CR1 = (SPIx->CR1 & ~(SPI_CR1_DEVICE_Msk)) |
+					pDevice->CLK_Phase | pDevice->CLK_Polarity | pDevice->frameFormat | pDevice->dataSize |
+					SPI_Get_BR(pclk, pDevice->SCK_Freq);
+		BITBAND_PERIPH(SPIx->CR1, SPI_CR1_SPE_Pos) = 1;
+
+		/* Clock changes keep the speed of the selected device */
+		Global_SPI_SCK_Freq[index] = pDevice->SCK_Freq;
+		bus->pCurrent = pDevice;
+	}
+
+	MCAL_GPIO_WritePin(pDevice->CS_Port, pDevice->CS_Pin, GPIO_PIN_RESET);
+
+	Global_SPI_DMA[index].P_Done_CallBack = (index == SPI1_Index) ? SPI1_Bus_CallBack : SPI2_Bus_CallBack;
+	status = SPI_DMA_Start(SPIx, pTransaction->pTxBuffer, pTransaction->pRxBuffer, pTransaction->length, DMA_Mode_Normal);
+
+	if(status != MCAL_OK)
+		SPI_Bus_Done(index, SPIx, status);
+}
+
+/**===============================================================================================
+ * @FName			- SPI_Slave_WriteIndex
+ * @Brief 			- Ring index the RX DMA writes next
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Return Value	- 0 .. RxRing_Length - 1
+ * Note				- NONE
+ */
+static uint16_t SPI_Slave_WriteIndex(uint8_t index){
+	uint16_t length = Global_SPI_Slave[index].config.RxRing_Length;
+	uint16_t writeIndex = length - MCAL_DMA_GetRemaining(Global_SPI_DMA_RxChannel[index]);
+
+	return (writeIndex >= length) ? 0 : writeIndex;
+}
+
+/**===============================================================================================
+ * @FName			- SPI_Slave_Arm
+ * @Brief 			- Pre-loads the next response: the SPI TX side is reset and its DMA restarted
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Parameter [in] 	- SPIx: SPI instance of this index
+ * @Return Value	- NONE
+ * Note				- Only while NSS is high, a frame already loaded in DR can only be dropped by an RCC reset
+ * 					- The RX channel keeps running, only RXDMAEN is restored
+ */
+static void SPI_Slave_Arm(uint8_t index, SPI_Typedef *SPIx){
+	SPI_Slave_t *slave = &Global_SPI_Slave[index];
+	SPI_DMA_t *dma = &Global_SPI_DMA[index];
+	uint16_t cr1 = SPIx->CR1;
+	uint16_t cr2 = SPIx->CR2;
+	uint16_t crcpr = SPIx->CRCPR;
+	DMA_Config_t DMA_Cfg;
+
+	MCAL_DMA_Stop(Global_SPI_DMA_TxChannel[index]);
+
+	if(index == SPI1_Index)
+		RCC_SPI1_CLK_RST();
+	else
+		RCC_SPI2_CLK_RST();
+
+	SPIx->CRCPR = crcpr;
+	SPIx->CR1 = cr1 & ~(SPI_CR1_SPE);
+
+	/* pNextTx --> SPIx->DR, the dummy frame is repeated by a circular channel */
+	if(cr1 & SPI_CR1_DFF){
+		DMA_Cfg.periphSize = DMA_PeriphSize_16bits;
+		DMA_Cfg.memSize = DMA_MemSize_16bits;
+	}
+	else{
+		DMA_Cfg.periphSize = DMA_PeriphSize_8bits;
+		DMA_Cfg.memSize = DMA_MemSize_8bits;
+	}
+	DMA_Cfg.direction = DMA_Direction_MemToPeriph;
+	DMA_Cfg.priority = DMA_Priority_High;
+	DMA_Cfg.periphInc = DMA_PeriphInc_Disable;
+	DMA_Cfg.IRQ_EN = DMA_IRQ_NONE;
+	DMA_Cfg.P_IRQ_CallBack = NULL;
+
+	if(slave->pNextTx != NULL){
+		DMA_Cfg.memInc = DMA_MemInc_Enable;
+		DMA_Cfg.mode = DMA_Mode_Normal;
+		MCAL_DMA_Init(Global_SPI_DMA_TxChannel[index], &DMA_Cfg);
+		MCAL_DMA_Start(Global_SPI_DMA_TxChannel[index], (uint32_t)&SPIx->DR, (uint32_t)slave->pNextTx, slave->nextTxLength);
+	}
+	else{
+		DMA_Cfg.memInc = DMA_MemInc_Disable;
+		DMA_Cfg.mode = DMA_Mode_Circular;
+		MCAL_DMA_Init(Global_SPI_DMA_TxChannel[index], &DMA_Cfg);
+		MCAL_DMA_Start(Global_SPI_DMA_TxChannel[index], (uint32_t)&SPIx->DR, (uint32_t)&dma->txDummy, 1);
+	}
+
+	/* TXE is set after the reset: the first frame is in DR before SCK starts */
+	SPIx->CR2 = cr2 | SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN;
+	SPIx->CR1 = cr1 | SPI_CR1_SPE;
+}
+
+/**===============================================================================================
+ * @FName			- SPI_Slave_NSS_Handler
+ * @Brief 			- NSS edge: marks the transaction boundaries and re-arms the response at the end
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Parameter [in] 	- SPIx: SPI instance of this index
+ * @Return Value	- NONE
+ * Note				- Called from the EXTI interrupt (both edges), the pin level tells the edge
+ */
+static void SPI_Slave_NSS_Handler(uint8_t index, SPI_Typedef *SPIx){
+	SPI_Slave_t *slave = &Global_SPI_Slave[index];
+	uint16_t writeIndex = SPI_Slave_WriteIndex(index);
+	uint16_t frames;
+	uint8_t nss;
+
+	if(!slave->running)
+		return;
+
+	nss = (index == SPI1_Index) ? MCAL_GPIO_ReadPin(GPIOA, GPIO_PIN_4) : MCAL_GPIO_ReadPin(GPIOB, GPIO_PIN_12);
+
+	if(nss == GPIO_PIN_RESET){
+		slave->selectIndex = writeIndex;
+
+		if(slave->config.P_Event_CallBack != NULL)
+			slave->config.P_Event_CallBack(SPI_Slave_Event_Select, 0);
+	}
+	else{
+		frames = (writeIndex >= slave->selectIndex) ? (writeIndex - slave->selectIndex) :
+				 (writeIndex + slave->config.RxRing_Length - slave->selectIndex);
+
+		SPI_Slave_Arm(index, SPIx);
+
+		if(slave->config.P_Event_CallBack != NULL)
+			slave->config.P_Event_CallBack(SPI_Slave_Event_Deselect, frames);
+	}
+}
+
+static void SPI1_NSS_CallBack(void){
+	SPI_Slave_NSS_Handler(SPI1_Index, SPI1);
+}
+
+static void SPI2_NSS_CallBack(void){
+	SPI_Slave_NSS_Handler(SPI2_Index, SPI2);
+}
+
+/**===============================================================================================
+ * @FName			- SPI_Slave_NSS_EXTI
+ * @Brief 			- Enables the NSS EXTI line (PA4 for SPI1, PB12 for SPI2) on both edges
+ * @Parameter [in] 	- index: SPI index (0 --> SPI1, 1 --> SPI2)
+ * @Return Value	- NONE
+ * Note				- The pin stays an input, the SPI keeps reading NSS from it
+ */
+static void SPI_Slave_NSS_EXTI(uint8_t index){
+	EXTI_PinConfig_t EXTI_Cfg;
+
+	EXTI_Cfg.pin = (index == SPI1_Index) ? EXTI4_PA4 : EXTI12_PB12;
+	EXTI_Cfg.triggerCase = EXTI_Trigger_RISING_OR_FALLING;
+	EXTI_Cfg.IRQ_EN = EXTI_IRQ_ENABLE;
+	EXTI_Cfg.P_IRQ_CallBack = (index == SPI1_Index) ? SPI1_NSS_CallBack : SPI2_NSS_CallBack;
+
+	MCAL_EXTI_GPIO_Update(&EXTI_Cfg);
+}
 
 /*******************************************************/
 
@@ -46,7 +736,7 @@ static SPI_Config_t Global_SPI2_Config;
  * @param [in]   - SPIx: where x is (1,2)
  * @param [in]   - SPI_config: All configuration for SPI
  * @retval       - None
- * Note          - None
+ * Note          - The SCK frequency follows later clock changes made through the RCC driver
  */
 void MCAL_SPI_Init(SPI_Typedef *SPIx, SPI_Config_t* SPI_config){
 	uint16_t tmp_CR1 = 0;
@@ -55,11 +745,13 @@ void MCAL_SPI_Init(SPI_Typedef *SPIx, SPI_Config_t* SPI_config){
 	if(SPIx == SPI1){
 		Global_SPI1_Config = *SPI_config;
 		Global_SPI_Config[SPI1_Index] = &Global_SPI1_Config;
+		Global_SPI_SCK_Freq[SPI1_Index] = MCAL_RCC_GetPCLK2Freq() >> ((SPI_config->CLK_Frequency >> 3) + 1);
 		RCC_SPI1_CLK_EN();
 	}
 	else if (SPIx == SPI2){
 		Global_SPI2_Config = *SPI_config;
 		Global_SPI_Config[SPI2_Index] = &Global_SPI2_Config;
+		Global_SPI_SCK_Freq[SPI2_Index] = MCAL_RCC_GetPCLK1Freq() >> ((SPI_config->CLK_Frequency >> 3) + 1);
 		RCC_SPI2_CLK_EN();
 	}
 
@@ -89,7 +781,8 @@ void MCAL_SPI_Init(SPI_Typedef *SPIx, SPI_Config_t* SPI_config){
 		tmp_CR2 |= SPI_config->NSS;
 	}
 	else if(SPI_config->NSS == SPI_NSS_HW_Master_ss_output_Disable){
-		tmp_CR2 &= SPI_config->NSS;
+		/* CR2 Bit 2 SSOE: SS output disable */
+		tmp_CR2 &= ~(SPI_NSS_HW_Master_ss_output_Enable);
 	}
 	else{
 		tmp_CR1 |= SPI_config->NSS;
@@ -110,8 +803,16 @@ void MCAL_SPI_Init(SPI_Typedef *SPIx, SPI_Config_t* SPI_config){
 		}
 	}
 
+	/* CRC */
+	if(SPI_config->CRC_Enable == SPI_CRC_Enable){
+		SPIx->CRCPR = (SPI_config->CRC_Polynomial != 0) ? SPI_config->CRC_Polynomial : SPI_CRC_POLYNOMIAL_DEFAULT;
+		tmp_CR1 |= SPI_CRC_Enable;
+	}
+
 	SPIx->CR1 = tmp_CR1;
 	SPIx->CR2 = tmp_CR2;
+
+	MCAL_RCC_Subscribe(SPI_ClockChange_CallBack);
 }
 
 /**================================================================
@@ -122,13 +823,30 @@ void MCAL_SPI_Init(SPI_Typedef *SPIx, SPI_Config_t* SPI_config){
  * Note          - None
  */
 void MCAL_SPI_Deinit(SPI_Typedef *SPIx){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+
+	MCAL_SPI_Slave_Stop(SPIx);
+
+	/* DMA channels are not reset with the SPI */
+	if(Global_SPI_DMA[index].busy){
+		SPI_DMA_Stop(index, SPIx);
+		Global_SPI_DMA[index].stream = 0;
+	}
+
+	/* Queued bus transactions are dropped, the CR1 device settings are gone */
+	Global_SPI_Bus[index].head = Global_SPI_Bus[index].tail;
+	Global_SPI_Bus[index].running = 0;
+	Global_SPI_Bus[index].pCurrent = NULL;
+
 	if(SPIx == SPI1){
 		NVIC_IRQ35_SPI1_DISABLE();
 		RCC_SPI1_CLK_RST();
+		Global_SPI_Config[SPI1_Index] = NULL;
 	}else if (SPIx == SPI2)
 	{
 		NVIC_IRQ36_SPI2_DISABLE();
 		RCC_SPI2_CLK_RST();
+		Global_SPI_Config[SPI2_Index] = NULL;
 	}
 }
 
@@ -138,14 +856,23 @@ void MCAL_SPI_Deinit(SPI_Typedef *SPIx){
  * @param [in]   - SPIx: where x is (1,2)
  * @param [in]   - TxBuffer
  * @param [in]   - Polling enable or not
- * @retval       - None
+ * @retval       - MCAL_OK, MCAL_TIMEOUT if TXE is not set within SPI_TIMEOUT_DEFAULT (nothing is sent)
  * Note          - None
  */
-void MCAL_SPI_SendData(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech pollingEN){
-	if(pollingEN == Enable)
-		while(!(SPIx->SR & SPI_SR_TXE));
+MCAL_Status_t MCAL_SPI_SendData(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech pollingEN){
+	if(pollingEN == Enable){
+		DWT_Timeout_t timer;
+
+		MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+		while(!(SPIx->SR & SPI_SR_TXE)){
+			if(DWT_TIMEOUT_EXPIRED(timer))
+				return MCAL_TIMEOUT;
+		}
+	}
 
 	SPIx->DR = *TX_Buffer;
+
+	return MCAL_OK;
 }
 
 /**================================================================
@@ -154,14 +881,23 @@ void MCAL_SPI_SendData(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech
  * @param [in]   - SPIx: where x is (1,2)
  * @param [in]   - RxBuffer
  * @param [in]   - Polling enable or not
- * @retval       - None
+ * @retval       - MCAL_OK, MCAL_TIMEOUT if RXNE is not set within SPI_TIMEOUT_DEFAULT (RX_Buffer untouched)
  * Note          - None
  */
-void MCAL_SPI_ReceiveData(SPI_Typedef *SPIx, uint16_t *RX_Buffer, enum Polling_Mech pollingEN){
-	if(pollingEN == Enable)
-			while(!(SPIx->SR & SPI_SR_RXNE));
+MCAL_Status_t MCAL_SPI_ReceiveData(SPI_Typedef *SPIx, uint16_t *RX_Buffer, enum Polling_Mech pollingEN){
+	if(pollingEN == Enable){
+		DWT_Timeout_t timer;
+
+		MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+		while(!(SPIx->SR & SPI_SR_RXNE)){
+			if(DWT_TIMEOUT_EXPIRED(timer))
+				return MCAL_TIMEOUT;
+		}
+	}
 
 	*RX_Buffer = SPIx->DR;
+
+	return MCAL_OK;
 }
 
 /**================================================================
@@ -170,98 +906,582 @@ void MCAL_SPI_ReceiveData(SPI_Typedef *SPIx, uint16_t *RX_Buffer, enum Polling_M
  * @param [in]   - SPIx: where x is (1,2)
  * @param [in]   - TxBuffer
  * @param [in]   - Polling enable or not
- * @retval       - None
+ * @retval       - MCAL_OK, MCAL_TIMEOUT if TXE or RXNE is not set within SPI_TIMEOUT_DEFAULT
  * Note          - None
  */
-void MCAL_SPI_TX_RX(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech pollingEN){
-	if(pollingEN == Enable)
-		while(!(SPIx->SR & SPI_SR_TXE));
+MCAL_Status_t MCAL_SPI_TX_RX(SPI_Typedef *SPIx, uint16_t *TX_Buffer, enum Polling_Mech pollingEN){
+	DWT_Timeout_t timer;
+
+	if(pollingEN == Enable){
+		MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+		while(!(SPIx->SR & SPI_SR_TXE)){
+			if(DWT_TIMEOUT_EXPIRED(timer))
+				return MCAL_TIMEOUT;
+		}
+	}
 	SPIx->DR = *TX_Buffer;
 
-	if(pollingEN == Enable)
-		while(!(SPIx->SR & SPI_SR_RXNE));
+	if(pollingEN == Enable){
+		DWT_TIMEOUT_RESTART(timer);
+		while(!(SPIx->SR & SPI_SR_RXNE)){
+			if(DWT_TIMEOUT_EXPIRED(timer))
+				return MCAL_TIMEOUT;
+		}
+	}
 	*TX_Buffer = SPIx->DR;
+
+	return MCAL_OK;
 }
 
 /**================================================================
- * @Fn           - MCAL_SPI_GPIO_SET_PINs
- * @brief        - Initialization GPIO pins
+ * @Fn           - MCAL_SPI_Transfer
+ * @brief        - Full duplex block transfer, TX kept one frame ahead of RX so SCK runs without gaps
  * @param [in]   - SPIx: where x is (1,2)
+ * @param [in]   - pTxBuffer: frames to send (NULL: SPI_DUMMY_FRAME is sent)
+ * @param [out]  - pRxBuffer: received frames (NULL: discarded)
+ * @param [in]   - length: number of frames
+ * @retval       - MCAL_OK, MCAL_TIMEOUT if no frame moves within SPI_TIMEOUT_DEFAULT,
+ *                 MCAL_ERROR if CRC is enabled and the received CRC is wrong
+ * Note          - Frames are uint8_t, or uint16_t with SPI_Data_Size_16bits
+ *               - With CRC_Enable the CRC frame is sent after the last frame (CRCNEXT) and the received one is checked
+ *               - At most two frames are in flight (TX buffer + shift register), so RX never overruns
+ *               - Keep interrupts short during the call at fPCLK/2, a late RXNE read loses the next frame
+ */
+MCAL_Status_t MCAL_SPI_Transfer(SPI_Typedef *SPIx, const void *pTxBuffer, void *pRxBuffer, size_t length){
+	return SPI_Transfer(SPIx, pTxBuffer, pRxBuffer, length, 0);
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Transmit
+ * @brief        - Transmit only block transfer, TXE refilled back to back
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [in]   - pTxBuffer: frames to send
+ * @param [in]   - length: number of frames
+ * @retval       - MCAL_OK, MCAL_TIMEOUT if TXE / BSY does not change within SPI_TIMEOUT_DEFAULT
+ * Note          - Frames are uint8_t, or uint16_t with SPI_Data_Size_16bits
+ *               - With CRC_Enable the CRC frame is sent after the last frame, nothing is checked
+ *               - Returns once the last frame is out (BSY = 0), the RX overrun it causes is cleared
+ */
+MCAL_Status_t MCAL_SPI_Transmit(SPI_Typedef *SPIx, const void *pTxBuffer, size_t length){
+	const uint8_t *pTx8 = pTxBuffer;
+	const uint16_t *pTx16 = pTxBuffer;
+	uint8_t is16Bit = (SPIx->CR1 & SPI_CR1_DFF) ? 1 : 0;
+	size_t txCount;
+	DWT_Timeout_t timer;
+
+	SPI_CRC_Reset(SPIx);
+	MCAL_DWT_Timeout_Start(&timer, SPI_TIMEOUT_DEFAULT);
+
+	for(txCount = 0; txCount < length; txCount++){
+		while(!(SPIx->SR & SPI_SR_TXE)){
+			if(DWT_TIMEOUT_EXPIRED(timer))
+				return MCAL_TIMEOUT;
+		}
+
+		SPIx->DR = is16Bit ? pTx16[txCount] : pTx8[txCount];
+		DWT_TIMEOUT_RESTART(timer);
+	}
+
+	if(SPIx->CR1 & SPI_CR1_CRCEN)
+		SPIx->CR1 |= SPI_CR1_CRCNEXT;
+
+	/* Last frame leaves the shift register */
+	while(!(SPIx->SR & SPI_SR_TXE) || (SPIx->SR & SPI_SR_BSY)){
+		if(DWT_TIMEOUT_EXPIRED(timer))
+			return MCAL_TIMEOUT;
+	}
+
+	/* RX side was not read: clear RXNE / OVR (read DR then SR), its CRC result is meaningless */
+	(void)SPIx->DR;
+	(void)SPIx->SR;
+	SPIx->SR &= ~(SPI_SR_CRCERR);
+
+	return MCAL_OK;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Receive
+ * @brief        - Receive only block transfer, SPI_DUMMY_FRAME clocked out for every frame
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [out]  - pRxBuffer: received frames
+ * @param [in]   - length: number of frames
+ * @retval       - MCAL_OK, MCAL_TIMEOUT if no frame moves within SPI_TIMEOUT_DEFAULT
+ * Note          - Frames are uint8_t, or uint16_t with SPI_Data_Size_16bits
+ */
+MCAL_Status_t MCAL_SPI_Receive(SPI_Typedef *SPIx, void *pRxBuffer, size_t length){
+	return MCAL_SPI_Transfer(SPIx, NULL, pRxBuffer, length);
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Transfer_Packed
+ * @brief        - Full duplex byte stream moved as 16-bit frames: half the DR writes and RXNE events
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [in]   - pTxBuffer: bytes to send (NULL: SPI_DUMMY_FRAME is sent)
+ * @param [out]  - pRxBuffer: received bytes (NULL: discarded)
+ * @param [in]   - length: number of bytes, an odd last byte is moved as an 8-bit frame
+ * @param [in]   - byteOrder: @ref SPI_Byte_Order_define
+ * @retval       - see MCAL_SPI_Transfer(), MCAL_ERROR with CRC_Enable (the CRC would follow the frame size)
+ * Note          - SPI_Byte_Order_Stream sends the bytes in buffer order for MSB or LSB first frames, so the
+ *                 device sees the same stream as with MCAL_SPI_Transfer() in 8-bit mode
+ *               - The frame size of SPIx is restored before returning
+ */
+MCAL_Status_t MCAL_SPI_Transfer_Packed(SPI_Typedef *SPIx, const uint8_t *pTxBuffer, uint8_t *pRxBuffer, size_t length, uint8_t byteOrder){
+	uint16_t dff = SPIx->CR1 & SPI_CR1_DFF;
+	uint8_t swap;
+	MCAL_Status_t status;
+
+	if(SPIx->CR1 & SPI_CR1_CRCEN)
+		return MCAL_ERROR;
+
+	/* A 16-bit MSB first frame sends its high byte first, the buffer (little endian) holds it second */
+	swap = ((byteOrder == SPI_Byte_Order_Stream) && !(SPIx->CR1 & SPI_CR1_LSBFIRST)) ? 1 : 0;
+
+	SPI_Set_DFF(SPIx, SPI_Data_Size_16bits);
+	status = SPI_Transfer(SPIx, pTxBuffer, pRxBuffer, length / 2, swap);
+
+	if((status == MCAL_OK) && (length & 1)){
+		SPI_Set_DFF(SPIx, SPI_Data_Size_8bits);
+		status = SPI_Transfer(SPIx, (pTxBuffer != NULL) ? &pTxBuffer[length - 1] : NULL,
+							  (pRxBuffer != NULL) ? &pRxBuffer[length - 1] : NULL, 1, 0);
+	}
+
+	SPI_Set_DFF(SPIx, dff);
+
+	return status;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Transfer_DMA
+ * @brief        - Full duplex block transfer moved by DMA1
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [in]   - pTxBuffer: frames to send (NULL: SPI_DUMMY_FRAME is sent), must stay valid until the callback
+ * @param [out]  - pRxBuffer: received frames (NULL: discarded), valid once the callback reports MCAL_OK
+ * @param [in]   - length: number of frames (1..65535)
+ * @param [in]   - P_Done_CallBack: called from the DMA interrupt once the last frame is received (MCAL_OK)
+ *                 or on a DMA bus error / wrong received CRC (MCAL_ERROR), or if the CRC frame is not
+ *                 received within SPI_TIMEOUT_DEFAULT (MCAL_TIMEOUT), can be NULL
+ * @retval       - MCAL_OK if started, MCAL_BUSY if a DMA transfer is running on this SPI or a channel
+ *                 is claimed by another driver, MCAL_ERROR on wrong parameters
+ * Note          - Frames are uint8_t, or uint16_t with SPI_Data_Size_16bits
+ *               - With CRC_Enable the CRC frame is sent by the SPI and the received one checked (with pRxBuffer only)
+ *               - The per frame P_IRQ_Callback is not used, leave TXEIE / RXNEIE disabled
+ */
+MCAL_Status_t MCAL_SPI_Transfer_DMA(SPI_Typedef *SPIx, const void *pTxBuffer, void *pRxBuffer, uint16_t length, void (* P_Done_CallBack)(MCAL_Status_t status)){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+
+	if(Global_SPI_DMA[index].busy)
+		return MCAL_BUSY;
+
+	Global_SPI_DMA[index].P_Done_CallBack = P_Done_CallBack;
+
+	return SPI_DMA_Start(SPIx, pTxBuffer, pRxBuffer, length, DMA_Mode_Normal);
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Transmit_DMA
+ * @brief        - Transmit only block transfer moved by DMA1
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [in]   - pTxBuffer: frames to send, must stay valid until the callback
+ * @param [in]   - length: number of frames (1..65535)
+ * @param [in]   - P_Done_CallBack: called once the last frame is clocked out, can be NULL
+ * @retval       - see MCAL_SPI_Transfer_DMA()
+ * Note          - The received frames go to a sink so no overrun is left behind
+ */
+MCAL_Status_t MCAL_SPI_Transmit_DMA(SPI_Typedef *SPIx, const void *pTxBuffer, uint16_t length, void (* P_Done_CallBack)(MCAL_Status_t status)){
+	if(pTxBuffer == NULL)
+		return MCAL_ERROR;
+
+	return MCAL_SPI_Transfer_DMA(SPIx, pTxBuffer, NULL, length, P_Done_CallBack);
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Receive_DMA
+ * @brief        - Receive only block transfer moved by DMA1, SPI_DUMMY_FRAME clocked out for every frame
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [out]  - pRxBuffer: received frames, valid once the callback reports MCAL_OK
+ * @param [in]   - length: number of frames (1..65535)
+ * @param [in]   - P_Done_CallBack: called once the last frame is received, can be NULL
+ * @retval       - see MCAL_SPI_Transfer_DMA()
  * Note          - None
  */
-void MCAL_SPI_GPIO_SET_PINs(SPI_Typedef *SPIx){
+MCAL_Status_t MCAL_SPI_Receive_DMA(SPI_Typedef *SPIx, void *pRxBuffer, uint16_t length, void (* P_Done_CallBack)(MCAL_Status_t status)){
+	if(pRxBuffer == NULL)
+		return MCAL_ERROR;
+
+	return MCAL_SPI_Transfer_DMA(SPIx, NULL, pRxBuffer, length, P_Done_CallBack);
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_StartStream_DMA
+ * @brief        - Endless ping-pong streaming: one half of the buffer is on the wire while the other is refilled
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [in]   - pTxBuffer: circular TX buffer of length frames (NULL: SPI_DUMMY_FRAME is sent)
+ * @param [out]  - pRxBuffer: circular RX buffer of length frames (NULL: nothing is received)
+ * @param [in]   - length: frames of the whole buffer (both halves, even number, 2..65534)
+ * @param [in]   - P_Half_CallBack: called from the DMA interrupt with the half that is done and can be
+ *                 refilled / read until the next call, or with SPI_Stream_Error (@ref SPI_Stream_Half_define)
+ * @retval       - MCAL_OK if started, MCAL_BUSY if a DMA transfer is running on this SPI or a channel
+ *                 is claimed by another driver, MCAL_ERROR on wrong parameters
+ * Note          - With pRxBuffer the halves are reported by the RX channel (the half is fully clocked),
+ *                 else by the TX channel (the half is loaded into the SPI and can be overwritten)
+ *               - Not available with CRC_Enable (MCAL_ERROR)
+ *               - Runs until MCAL_SPI_StopStream_DMA(), or until a DMA transfer error: the stream is then
+ *                 already stopped when P_Half_CallBack(SPI_Stream_Error) is called and can be started again
+ */
+MCAL_Status_t MCAL_SPI_StartStream_DMA(SPI_Typedef *SPIx, const void *pTxBuffer, void *pRxBuffer, uint16_t length, void (* P_Half_CallBack)(uint8_t half)){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+
+	if((P_Half_CallBack == NULL) || (length < 2) || (length & 1))
+		return MCAL_ERROR;
+
+	if(Global_SPI_DMA[index].busy)
+		return MCAL_BUSY;
+
+	Global_SPI_DMA[index].P_Half_CallBack = P_Half_CallBack;
+
+	return SPI_DMA_Start(SPIx, pTxBuffer, pRxBuffer, length, DMA_Mode_Circular);
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_StopStream_DMA
+ * @brief        - Stops the streaming started by MCAL_SPI_StartStream_DMA()
+ * @param [in]   - SPIx: where x is (1,2)
+ * @retval       - None
+ * Note          - The frame on the wire is completed by the SPI, the rest of the half is dropped
+ */
+void MCAL_SPI_StopStream_DMA(SPI_Typedef *SPIx){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+
+	if(!Global_SPI_DMA[index].stream)
+		return;
+
+	SPI_DMA_Stop(index, SPIx);
+	Global_SPI_DMA[index].stream = 0;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Transfer_Packed_DMA
+ * @brief        - Full duplex byte stream moved by DMA1 as 16-bit frames
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [in]   - pTxBuffer: bytes to send (NULL: SPI_DUMMY_FRAME is sent), half-word aligned
+ * @param [out]  - pRxBuffer: received bytes (NULL: discarded), half-word aligned
+ * @param [in]   - length: number of bytes (even, 2..65534)
+ * @param [in]   - byteOrder: @ref SPI_Byte_Order_define
+ * @param [in]   - P_Done_CallBack: see MCAL_SPI_Transfer_DMA()
+ * @retval       - see MCAL_SPI_Transfer_DMA()
+ * Note          - The DMA can not exchange bytes: SPI_Byte_Order_Stream needs SPI_Frame_Format_LSB_transmitted_first
+ *                 (MCAL_ERROR otherwise), with MSB first devices use SPI_Byte_Order_HalfWord on pre-swapped data
+ *               - SPIx goes back to 8-bit frames before the callback, CRC_Enable is not supported
+ */
+MCAL_Status_t MCAL_SPI_Transfer_Packed_DMA(SPI_Typedef *SPIx, const uint8_t *pTxBuffer, uint8_t *pRxBuffer, uint16_t length, uint8_t byteOrder, void (* P_Done_CallBack)(MCAL_Status_t status)){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+	SPI_DMA_t *dma = &Global_SPI_DMA[index];
+	MCAL_Status_t status;
+
+	if((length == 0) || (length & 1) || (((uint32_t)pTxBuffer | (uint32_t)pRxBuffer) & 1) ||
+	   (SPIx->CR1 & (SPI_CR1_CRCEN | SPI_CR1_DFF)))
+		return MCAL_ERROR;
+
+	if((byteOrder == SPI_Byte_Order_Stream) && !(SPIx->CR1 & SPI_CR1_LSBFIRST))
+		return MCAL_ERROR;
+
+	if(dma->busy)
+		return MCAL_BUSY;
+
+	SPI_Set_DFF(SPIx, SPI_Data_Size_16bits);
+
+	dma->P_Done_CallBack = P_Done_CallBack;
+	dma->packed = 1;
+	status = SPI_DMA_Start(SPIx, pTxBuffer, pRxBuffer, length / 2, DMA_Mode_Normal);
+
+	if(status != MCAL_OK){
+		dma->packed = 0;
+		SPI_Set_DFF(SPIx, SPI_Data_Size_8bits);
+	}
+
+	return status;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Bus_AddDevice
+ * @brief        - Registers a device of a shared SPI bus and configures its chip select pin (output, high)
+ * @param [in]   - SPIx: where x is (1,2), initialized as master with software NSS (SPI_NSS_SW_Set_SSI)
+ * @param [in]   - pDevice: device settings, must stay valid while the device is used
+ * @retval       - MCAL_OK, MCAL_ERROR if SPIx is not initialized or the settings are wrong
+ * Note          - The GPIO port clock must be enabled first
+ */
+MCAL_Status_t MCAL_SPI_Bus_AddDevice(SPI_Typedef *SPIx, SPI_Device_t *pDevice){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
 	GPIO_PinConfig_t PinCFG;
+	uint32_t pclk;
 
-	if(SPIx == SPI1)
-	{
-		//   For SPI1
-		// PA4 <<>> NSS
-		// PA5 <<>> SCK
-		// PA6 <<>> MISO
-		// PA7 <<>> MOSI
+	if((Global_SPI_Config[index] == NULL) || (pDevice == NULL) || (pDevice->CS_Port == NULL))
+		return MCAL_ERROR;
 
-		if(Global_SPI_Config[SPI1_Index]->deviceMode == SPI_Device_Mode_Master)
-		{
-			// PA4 <<>> NSS
-			switch(Global_SPI_Config[SPI1_Index]->NSS){
-				case SPI_NSS_HW_Master_ss_output_Disable:
-					PinCFG.pinNumber = GPIO_PIN_4;
-					PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-					MCAL_GPIO_Init(GPIOA, &PinCFG);
-					break;
-
-				case SPI_NSS_HW_Master_ss_output_Enable:
-					PinCFG.pinNumber = GPIO_PIN_4;
-					PinCFG.mode = GPIO_MODE_OUTPUT_AF_PP;
-					PinCFG.outputSpeed = GPIO_SPEED_10M;
-					MCAL_GPIO_Init(GPIOA, &PinCFG);
-					break;
-			}
+	pclk = (index == SPI1_Index) ? MCAL_RCC_GetPCLK2Freq() : MCAL_RCC_GetPCLK1Freq();
 
-			// PA5 <<>> SCK
-			PinCFG.pinNumber = GPIO_PIN_5;
-			PinCFG.mode = GPIO_MODE_OUTPUT_AF_PP;
-			PinCFG.outputSpeed = GPIO_SPEED_10M;
-			MCAL_GPIO_Init(GPIOA, &PinCFG);
+	pDevice->SPIx = SPIx;
+	pDevice->SCK_Freq = pclk >> (((pDevice->CLK_Frequency & SPI_CR1_BR_Msk) >> 3) + 1);
 
-			// PA6 <<>> MISO >> full duplex.
-			PinCFG.pinNumber = GPIO_PIN_6;
-			PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOA, &PinCFG);
+	/* Chip select idle high */
+	MCAL_GPIO_WritePin(pDevice->CS_Port, pDevice->CS_Pin, GPIO_PIN_SET);
 
-			// PA7 <<>> MOSI
-			PinCFG.pinNumber = GPIO_PIN_7;
-			PinCFG.mode = GPIO_MODE_OUTPUT_AF_PP;
-			PinCFG.outputSpeed = GPIO_SPEED_10M;
-			MCAL_GPIO_Init(GPIOA, &PinCFG);
+	PinCFG.pinNumber = pDevice->CS_Pin;
+	PinCFG.mode = GPIO_MODE_OUTPUT_PP;
+	PinCFG.outputSpeed = GPIO_SPEED_10M;
+	MCAL_GPIO_Init(pDevice->CS_Port, &PinCFG);
 
-		}
-		else
-		{
-			if(Global_SPI_Config[SPI1_Index]->NSS == SPI_NSS_HW_Slave){
-				PinCFG.pinNumber = GPIO_PIN_4;
-				PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-				MCAL_GPIO_Init(GPIOA, &PinCFG);
-			}
+	return MCAL_OK;
+}
 
-			//PA5 <<>> SCK
-			PinCFG.pinNumber = GPIO_PIN_5;
-			PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOA, &PinCFG);
+/**================================================================
+ * @Fn           - MCAL_SPI_Bus_Submit
+ * @brief        - Queues a transaction, it runs by DMA right away if the bus is idle
+ * @param [in]   - pTransaction: transaction description, must stay valid until its callback
+ * @retval       - MCAL_OK if queued, MCAL_BUSY if the queue is full, MCAL_ERROR on wrong parameters
+ * Note          - Queued transactions run back to back from the DMA interrupt, CS is held low for each one
+ *               - Submit from one interrupt level only (thread or one ISR)
+ *               - Do not use the other SPI APIs on a bus while transactions are queued
+ */
+MCAL_Status_t MCAL_SPI_Bus_Submit(SPI_Transaction_t *pTransaction){
+	SPI_Typedef *SPIx;
+	SPI_Bus_t *bus;
+	uint8_t index;
 
-			// PA6 <<>> MISO
-			PinCFG.pinNumber = GPIO_PIN_6;
-			PinCFG.mode = GPIO_MODE_OUTPUT_AF_PP;
-			PinCFG.outputSpeed = GPIO_SPEED_10M;
-			MCAL_GPIO_Init(GPIOA, &PinCFG);
+	if((pTransaction == NULL) || (pTransaction->pDevice == NULL) || (pTransaction->pDevice->SPIx == NULL) || (pTransaction->length == 0))
+		return MCAL_ERROR;
 
-			// PA7 <<>> MOSI
-			PinCFG.pinNumber = GPIO_PIN_7;
-			PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOA, &PinCFG);
+	SPIx = pTransaction->pDevice->SPIx;
+	index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+	bus = &Global_SPI_Bus[index];
 
-		}
+	if((uint8_t)(bus->tail - bus->head) >= SPI_BUS_QUEUE_SIZE)
+		return MCAL_BUSY;
+
+	bus->queue[bus->tail & (SPI_BUS_QUEUE_SIZE - 1)] = pTransaction;
+	bus->tail++;
+
+	/* A running bus picks it up from its DMA interrupt */
+	if(!bus->running)
+		SPI_Bus_Next(index, SPIx);
+
+	return MCAL_OK;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Bus_IsIdle
+ * @brief        - Bus manager state
+ * @param [in]   - SPIx: where x is (1,2)
+ * @retval       - 1 if no transaction is running or queued, else 0
+ * Note          - None
+ */
+uint8_t MCAL_SPI_Bus_IsIdle(SPI_Typedef *SPIx){
+	return !Global_SPI_Bus[(SPIx == SPI1) ? SPI1_Index : SPI2_Index].running;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Slave_Start
+ * @brief        - Starts the slave engine: RX ring and response by DMA, NSS edges by EXTI
+ * @param [in]   - SPIx: where x is (1,2), initialized as slave with SPI_NSS_HW_Slave and its pins set
+ * @param [in]   - pConfig: ring, first response and event callback (copied, the buffers are used in place)
+ * @retval       - MCAL_OK, MCAL_BUSY if a DMA transfer is running on this SPI or a channel is claimed
+ *                 by another driver, MCAL_ERROR on wrong parameters
+ * Note          - Frames are uint8_t, or uint16_t with SPI_Data_Size_16bits
+ *               - No CPU work per frame: the host can run SCK at the SPI slave limit (fPCLK/2)
+ *               - AFIO and the NSS GPIO port clocks must be enabled first, CRC is not supported
+ */
+MCAL_Status_t MCAL_SPI_Slave_Start(SPI_Typedef *SPIx, const SPI_Slave_Config_t *pConfig){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+	SPI_Slave_t *slave = &Global_SPI_Slave[index];
+	SPI_DMA_t *dma = &Global_SPI_DMA[index];
+	DMA_Config_t DMA_Cfg;
+
+	if((Global_SPI_Config[index] == NULL) || (pConfig == NULL) || (pConfig->pRxRing == NULL) || (pConfig->RxRing_Length == 0) ||
+	   (pConfig->pTxBuffer != NULL && pConfig->TxLength == 0))
+		return MCAL_ERROR;
+
+	if((Global_SPI_Config[index]->deviceMode != SPI_Device_Mode_Slave) || (Global_SPI_Config[index]->NSS != SPI_NSS_HW_Slave) ||
+	   (SPIx->CR1 & SPI_CR1_CRCEN))
+		return MCAL_ERROR;
+
+	if(dma->busy)
+		return MCAL_BUSY;
 
+	if(MCAL_DMA_Claim(Global_SPI_DMA_TxChannel[index], SPIx) != MCAL_OK)
+		return MCAL_BUSY;
+
+	if(MCAL_DMA_Claim(Global_SPI_DMA_RxChannel[index], SPIx) != MCAL_OK){
+		MCAL_DMA_Release(Global_SPI_DMA_TxChannel[index], SPIx);
+		return MCAL_BUSY;
+	}
+
+	/* Both channels belong to the engine, the other DMA APIs report MCAL_BUSY */
+	dma->busy = 1;
+	dma->stream = 0;
+	dma->useRx = 1;
+	dma->txDummy = SPI_DUMMY_FRAME;
+
+	slave->config = *pConfig;
+	slave->pNextTx = pConfig->pTxBuffer;
+	slave->nextTxLength = pConfig->TxLength;
+	slave->readIndex = 0;
+	slave->selectIndex = 0;
+
+	/* SPIx->DR --> pRxRing, circular: never stopped between transactions */
+	if(SPIx->CR1 & SPI_CR1_DFF){
+		DMA_Cfg.periphSize = DMA_PeriphSize_16bits;
+		DMA_Cfg.memSize = DMA_MemSize_16bits;
+	}
+	else{
+		DMA_Cfg.periphSize = DMA_PeriphSize_8bits;
+		DMA_Cfg.memSize = DMA_MemSize_8bits;
+	}
+	DMA_Cfg.direction = DMA_Direction_PeriphToMem;
+	DMA_Cfg.priority = DMA_Priority_VeryHigh;
+	DMA_Cfg.periphInc = DMA_PeriphInc_Disable;
+	DMA_Cfg.memInc = DMA_MemInc_Enable;
+	DMA_Cfg.mode = DMA_Mode_Circular;
+	DMA_Cfg.IRQ_EN = DMA_IRQ_NONE;
+	DMA_Cfg.P_IRQ_CallBack = NULL;
+	MCAL_DMA_Init(Global_SPI_DMA_RxChannel[index], &DMA_Cfg);
+	MCAL_DMA_Start(Global_SPI_DMA_RxChannel[index], (uint32_t)&SPIx->DR, (uint32_t)pConfig->pRxRing, pConfig->RxRing_Length);
+
+	SPI_Slave_Arm(index, SPIx);
+
+	slave->running = 1;
+	SPI_Slave_NSS_EXTI(index);
+
+	return MCAL_OK;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Slave_Stop
+ * @brief        - Stops the slave engine started by MCAL_SPI_Slave_Start()
+ * @param [in]   - SPIx: where x is (1,2)
+ * @retval       - None
+ * Note          - The NSS EXTI line is disabled and both DMA channels are given back
+ */
+void MCAL_SPI_Slave_Stop(SPI_Typedef *SPIx){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+
+	if(!Global_SPI_Slave[index].running)
+		return;
+
+	Global_SPI_Slave[index].running = 0;
+
+	/* Line masked only: the NVIC vector of EXTI15_10 can be shared with other pins */
+	EXTI->IMR &= ~(1 << ((index == SPI1_Index) ? EXTI4 : EXTI12));
+	SPI_DMA_Stop(index, SPIx);
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Slave_SetResponse
+ * @brief        - Changes the response clocked out to the host
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [in]   - pTxBuffer: response frames (NULL: SPI_DUMMY_FRAME), must stay valid while it is armed
+ * @param [in]   - length: number of frames
+ * @retval       - MCAL_OK, MCAL_ERROR if the engine is not running or on wrong parameters
+ * Note          - Armed right away if NSS is high, else at the end of the running transaction
+ *               - Call it between transactions (e.g. from SPI_Slave_Event_Deselect), the host must not
+ *                 select the slave while it is armed
+ */
+MCAL_Status_t MCAL_SPI_Slave_SetResponse(SPI_Typedef *SPIx, const void *pTxBuffer, uint16_t length){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+	SPI_Slave_t *slave = &Global_SPI_Slave[index];
+	uint8_t nss;
+
+	if(!slave->running || ((pTxBuffer != NULL) && (length == 0)))
+		return MCAL_ERROR;
+
+	slave->pNextTx = pTxBuffer;
+	slave->nextTxLength = length;
+
+	nss = (index == SPI1_Index) ? MCAL_GPIO_ReadPin(GPIOA, GPIO_PIN_4) : MCAL_GPIO_ReadPin(GPIOB, GPIO_PIN_12);
+	if(nss == GPIO_PIN_SET)
+		SPI_Slave_Arm(index, SPIx);
+
+	return MCAL_OK;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Slave_Available
+ * @brief        - Frames received from the host and not read yet
+ * @param [in]   - SPIx: where x is (1,2)
+ * @retval       - 0 .. RxRing_Length - 1
+ * Note          - None
+ */
+uint16_t MCAL_SPI_Slave_Available(SPI_Typedef *SPIx){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+	SPI_Slave_t *slave = &Global_SPI_Slave[index];
+	uint16_t writeIndex;
+
+	if(!slave->running)
+		return 0;
+
+	writeIndex = SPI_Slave_WriteIndex(index);
+
+	return (writeIndex >= slave->readIndex) ? (writeIndex - slave->readIndex) :
+		   (writeIndex + slave->config.RxRing_Length - slave->readIndex);
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_Slave_Read
+ * @brief        - Copies received frames out of the RX ring
+ * @param [in]   - SPIx: where x is (1,2)
+ * @param [out]  - pBuffer: destination (uint8_t, or uint16_t frames with SPI_Data_Size_16bits)
+ * @param [in]   - length: maximum number of frames
+ * @retval       - Number of frames copied
+ * Note          - Single reader (thread or one ISR), the DMA keeps writing the ring meanwhile
+ */
+uint16_t MCAL_SPI_Slave_Read(SPI_Typedef *SPIx, void *pBuffer, uint16_t length){
+	uint8_t index = (SPIx == SPI1) ? SPI1_Index : SPI2_Index;
+	SPI_Slave_t *slave = &Global_SPI_Slave[index];
+	uint8_t is16Bit = (SPIx->CR1 & SPI_CR1_DFF) ? 1 : 0;
+	uint16_t available = MCAL_SPI_Slave_Available(SPIx);
+	uint16_t count;
+
+	if(length > available)
+		length = available;
+
+	for(count = 0; count < length; count++){
+		if(is16Bit)
+			((uint16_t *)pBuffer)[count] = ((const uint16_t *)slave->config.pRxRing)[slave->readIndex];
+		else
+			((uint8_t *)pBuffer)[count] = ((const uint8_t *)slave->config.pRxRing)[slave->readIndex];
+
+		if(++slave->readIndex >= slave->config.RxRing_Length)
+			slave->readIndex = 0;
+	}
+
+	return count;
+}
+
+/**================================================================
+ * @Fn           - MCAL_SPI_GPIO_SET_PINs
+ * @brief        - Initialization GPIO pins
+ * @param [in]   - SPIx: where x is (1,2)
+ * Note          - None
+ */
+void MCAL_SPI_GPIO_SET_PINs(SPI_Typedef *SPIx){
+	SPI_Config_t *config;
+	GPIO_PinConfig_t PinCFG[2];
+	GPIO_TypeDef *GPIOx;
+	uint16_t NSS_Pin, SCK_Pin, MISO_Pin, MOSI_Pin;
+	uint16_t outputPins, inputPins;
+
+	if(SPIx == SPI1)
+	{
+		//   For SPI1
+		// PA4 <<>> NSS
+		// PA5 <<>> SCK
+		// PA6 <<>> MISO
+		// PA7 <<>> MOSI
+		config = Global_SPI_Config[SPI1_Index];
+		GPIOx = GPIOA;
+		NSS_Pin = GPIO_PIN_4;
+		SCK_Pin = GPIO_PIN_5;
+		MISO_Pin = GPIO_PIN_6;
+		MOSI_Pin = GPIO_PIN_7;
 	}
 	else if (SPIx == SPI2)
 	{
@@ -270,69 +1490,45 @@ void MCAL_SPI_GPIO_SET_PINs(SPI_Typedef *SPIx){
 		// PB13 <<>> SCK
 		// PB14 <<>> MISO
 		// PB15 <<>> MOSI
+		config = Global_SPI_Config[SPI2_Index];
+		GPIOx = GPIOB;
+		NSS_Pin = GPIO_PIN_12;
+		SCK_Pin = GPIO_PIN_13;
+		MISO_Pin = GPIO_PIN_14;
+		MOSI_Pin = GPIO_PIN_15;
+	}
+	else
+	{
+		return;
+	}
 
-		if(Global_SPI_Config[SPI2_Index]->deviceMode == SPI_Device_Mode_Master)
-		{
-			//PB12 <<>> NSS
-			switch(Global_SPI_Config[SPI2_Index]->NSS){
-			case SPI_NSS_HW_Master_ss_output_Disable:
-				PinCFG.pinNumber = GPIO_PIN_12;
-				PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-				MCAL_GPIO_Init(GPIOB, &PinCFG);
-				break;
-
-			case SPI_NSS_HW_Master_ss_output_Enable:
-				PinCFG.pinNumber = GPIO_PIN_12;
-				PinCFG.mode = GPIO_MODE_OUTPUT_AF_PP;
-				PinCFG.outputSpeed = GPIO_SPEED_10M;
-				MCAL_GPIO_Init(GPIOB, &PinCFG);
-				break;
-			}
-
-			// PB13 <<>> SCK
-			PinCFG.pinNumber = GPIO_PIN_13;
-			PinCFG.mode = GPIO_MODE_OUTPUT_AF_PP;
-			PinCFG.outputSpeed = GPIO_SPEED_10M;
-			MCAL_GPIO_Init(GPIOB, &PinCFG);
-
-			// PB14 <<>> MISO >> full duplex.
-			PinCFG.pinNumber = GPIO_PIN_14;
-			PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOB, &PinCFG);
-
-			// PB15 <<>> MOSI
-			PinCFG.pinNumber = GPIO_PIN_15;
-			PinCFG.mode = GPIO_MODE_OUTPUT_AF_PP;
-			PinCFG.outputSpeed = GPIO_SPEED_10M;
-			MCAL_GPIO_Init(GPIOB, &PinCFG);
-
-
-		}else
-		{
-			if(Global_SPI_Config[SPI2_Index]->NSS == SPI_NSS_HW_Slave){
-				PinCFG.pinNumber = GPIO_PIN_12;
-				PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-				MCAL_GPIO_Init(GPIOB, &PinCFG);
-			}
+	if(config->deviceMode == SPI_Device_Mode_Master)
+	{
+		// SCK / MOSI driven, MISO >> full duplex.
+		outputPins = SCK_Pin | MOSI_Pin;
+		inputPins = MISO_Pin;
 
-			//PA5 <<>> SCK
-			PinCFG.pinNumber = GPIO_PIN_13;
-			PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOB, &PinCFG);
+		// NSS: output with SSOE, input when the SS output is disabled, free with software NSS
+		if(config->NSS == SPI_NSS_HW_Master_ss_output_Enable)
+			outputPins |= NSS_Pin;
+		else if(config->NSS == SPI_NSS_HW_Master_ss_output_Disable)
+			inputPins |= NSS_Pin;
+	}
+	else
+	{
+		// MISO driven, SCK / MOSI from the master
+		outputPins = MISO_Pin;
+		inputPins = SCK_Pin | MOSI_Pin;
 
-			// PA6 <<>> MISO
-			PinCFG.pinNumber = GPIO_PIN_14;
-			PinCFG.mode = GPIO_MODE_OUTPUT_AF_PP;
-			PinCFG.outputSpeed = GPIO_SPEED_10M;
-			MCAL_GPIO_Init(GPIOB, &PinCFG);
+		if(config->NSS == SPI_NSS_HW_Slave)
+			inputPins |= NSS_Pin;
+	}
 
-			// PA7 <<>> MOSI
-			PinCFG.pinNumber = GPIO_PIN_15;
-			PinCFG.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOB, &PinCFG);
+	PinCFG[0] = (GPIO_PinConfig_t){outputPins, GPIO_MODE_OUTPUT_AF_PP, GPIO_SPEED_10M};
+	PinCFG[1] = (GPIO_PinConfig_t){inputPins, GPIO_MODE_INPUT_FLOATING, GPIO_SPEED_10M};
 
-		}
-	}
+	/* The four pins share CRL (SPI1) or CRH (SPI2): one store, no half configured bus */
+	MCAL_GPIO_InitPins(GPIOx, PinCFG, 2);
 }
 
 /*******************************************************/
@@ -21,6 +21,181 @@
  * index [2] --> USART3
  */
 static USART_Config_t *Global_USART_Config[3] = {NULL, NULL, NULL};
+static USART_TypeDef * const Global_USART_Instance[3] = {USART1, USART2, USART3};
+
+/**
+ * Per-instance data resolved once in MCAL_USART_Init() so the per-frame
+ * path does not have to look at the configuration again.
+ */
+typedef struct{
+	uint16_t txMask;	/* data bits written to DR */
+	uint16_t rxMask;	/* data bits read from DR (parity bit removed) */
+	uint8_t is9Bit;		/* frames are packed as uint16_t in the bulk APIs */
+} USART_Handle_t;
+
+static USART_Handle_t Global_USART_Handle[3];
+
+/**
+ * DMA1 channels serving USARTx_TX requests (RM0008 Table 78)
+ * index [0] --> USART1_TX --> DMA1_Channel4
+ * index [1] --> USART2_TX --> DMA1_Channel7
+ * index [2] --> USART3_TX --> DMA1_Channel2
+ */
+static DMA_Channel_TypeDef * const Global_USART_DMA_TxChannel[3] = {DMA_Request_USART1_TX, DMA_Request_USART2_TX, DMA_Request_USART3_TX};
+static void (* Global_USART_DMA_TxCplt_CallBack[3])(MCAL_Status_t status) = {NULL, NULL, NULL};
+static volatile uint8_t Global_USART_DMA_TxBusy[3] = {0, 0, 0};
+
+/**
+ * DMA1 channels serving USARTx_RX requests (RM0008 Table 78)
+ * index [0] --> USART1_RX --> DMA1_Channel5
+ * index [1] --> USART2_RX --> DMA1_Channel6
+ * index [2] --> USART3_RX --> DMA1_Channel3
+ */
+static DMA_Channel_TypeDef * const Global_USART_DMA_RxChannel[3] = {DMA_Request_USART1_RX, DMA_Request_USART2_RX, DMA_Request_USART3_RX};
+
+/**
+ * Idle-line framed reception state (circular DMA + IDLE interrupt)
+ */
+typedef struct{
+	uint16_t length;		/* size of the caller circular buffer */
+	uint16_t lastPos;		/* DMA write position at the end of the previous frame */
+	void (* P_Frame_CallBack)(uint16_t offset, uint16_t length);
+} USART_IdleRx_t;
+
+static USART_IdleRx_t Global_USART_IdleRx[3];
+
+/**
+ * Single producer (USARTx_IRQHandler) / single consumer (MCAL_USART_Read) ring buffer.
+ * head is only written by the ISR and tail only by the reader, both run freely
+ * and are masked on access, so no interrupt locking is needed.
+ */
+typedef struct{
+	volatile uint16_t head;
+	volatile uint16_t tail;
+	uint16_t frames[USART_RX_BUFFER_SIZE];
+	USART_RxStats_t stats;
+} USART_RxRing_t;
+
+static USART_RxRing_t Global_USART_RxRing[3];
+
+/*******************************************************/
+
+/*******************************************************/
+/***************** Generic Macros **********************/
+/*******************************************************/
+#define USART_CR3_DMAT						((uint32_t)(1 << 7))	/* Bit 7 DMAT: DMA enable transmitter */
+#define USART_CR3_DMAR						((uint32_t)(1 << 6))	/* Bit 6 DMAR: DMA enable receiver */
+#define USART_SR_TXE						((uint32_t)(1 << 7))	/* Bit 7 TXE: Transmit data register empty */
+#define USART_SR_TC							((uint32_t)(1 << 6))	/* Bit 6 TC: Transmission complete */
+#define USART_SR_RXNE						((uint32_t)(1 << 5))	/* Bit 5 RXNE: Read data register not empty */
+#define USART_SR_IDLE						((uint32_t)(1 << 4))	/* Bit 4 IDLE: IDLE line detected */
+#define USART_SR_ORE						((uint32_t)(1 << 3))	/* Bit 3 ORE: Overrun error */
+
+#define USART_RX_BUFFER_MASK				(USART_RX_BUFFER_SIZE - 1)
+
+/**
+ * Branch-free USARTx --> driver table index:
+ * bits [12:11] of the base address are 3 (USART1), 0 (USART2) and 1 (USART3),
+ * 0x09 packs the matching indexes 0, 1 and 2 two bits each.
+ */
+#define USART_HASH(_USARTx_)				(((uint32_t)(_USARTx_) >> 11) & 0x3)
+#define USART_INDEX(_USARTx_)				((uint8_t)((0x09 >> (USART_HASH(_USARTx_) << 1)) & 0x3))
+
+/*******************************************************/
+
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
+/**===============================================================================================
+ * @FName			- USART_DMA_TxComplete
+ * @Brief 			- Common DMA completion handling of the USARTx_TX channel
+ * @Parameter [in] 	- index: USART index (0 --> USART1, 1 --> USART2, 2 --> USART3)
+ * @Parameter [in] 	- USARTx: USART instance of this index
+ * @Parameter [in] 	- irq_src: DMA interrupt source, TE is reported as MCAL_ERROR
+ * @Return Value	- NONE
+ * Note				- Called from the DMA TC/TE interrupt
+ */
+static void USART_DMA_TxComplete(uint8_t index, USART_TypeDef *USARTx, struct S_DMA_IRQ_SRC irq_src){
+	MCAL_DMA_Stop(Global_USART_DMA_TxChannel[index]);
+	MCAL_DMA_Release(Global_USART_DMA_TxChannel[index], USARTx);
+
+	/* Give DR back to the CPU path */
+	USARTx->CR3 &= ~(USART_CR3_DMAT);
+
+	Global_USART_DMA_TxBusy[index] = 0;
+
+	if(Global_USART_DMA_TxCplt_CallBack[index] != NULL)
+		Global_USART_DMA_TxCplt_CallBack[index](irq_src.TE ? MCAL_ERROR : MCAL_OK);
+}
+
+static void USART1_DMA_Tx_CallBack(struct S_DMA_IRQ_SRC irq_src){
+	USART_DMA_TxComplete(0, USART1, irq_src);
+}
+
+static void USART2_DMA_Tx_CallBack(struct S_DMA_IRQ_SRC irq_src){
+	USART_DMA_TxComplete(1, USART2, irq_src);
+}
+
+static void USART3_DMA_Tx_CallBack(struct S_DMA_IRQ_SRC irq_src){
+	USART_DMA_TxComplete(2, USART3, irq_src);
+}
+
+/**===============================================================================================
+ * @FName			- USART_Set_BaudRate
+ * @Brief 			- Programs BRR for the configured baud rate
+ * @Parameter [in] 	- USARTx: where x can be (1..3 depending on device used)
+ * @Parameter [in] 	- pClocks: current bus frequencies
+ * @Return Value	- NONE
+ * Note				- PCLK2 For USART1, PCLK1 For USART2, USART3
+ */
+static void USART_Set_BaudRate(USART_TypeDef *USARTx, const RCC_Clocks_t *pClocks){
+	uint32_t pclk = (USARTx == USART1) ? pClocks->PCLK2_Freq : pClocks->PCLK1_Freq;
+
+	/* Bits 15:4 DIV_Mantissa[11:0]: mantissa of USARTDIV */
+	/* Bits 3:0 DIV_Fraction[3:0]: fraction of USARTDIV */
+	USARTx->BRR = USART_BRR_REGISTER(pclk, Global_USART_Config[USART_INDEX(USARTx)]->baudRate);
+}
+
+/**===============================================================================================
+ * @FName			- USART_ClockChange_CallBack
+ * @Brief 			- Keeps the baud rate of every initialized USART after a clock change
+ * @Parameter [in] 	- pClocks: new bus frequencies
+ * @Return Value	- NONE
+ * Note				- Subscribed to the RCC driver by MCAL_USART_Init()
+ */
+static void USART_ClockChange_CallBack(const RCC_Clocks_t *pClocks){
+	uint8_t i;
+
+	for(i = 0; i < 3; i++){
+		if(Global_USART_Config[i] != NULL)
+			USART_Set_BaudRate(Global_USART_Instance[i], pClocks);
+	}
+}
+
+/**===============================================================================================
+ * @FName			- USART_ClockChange_Busy
+ * @Brief 			- Holds back the RCC governor while a USART is transmitting
+ * @Return Value	- 1 if a DMA TX is running or a transmitter has not shifted out its last frame (TC = 0), else 0
+ * Note				- Registered to the RCC driver by MCAL_USART_Init(), a new BRR in the middle of
+ * 					  a frame would corrupt it
+ * 					- Reception is not covered, continuous RX loses the characters of a switch
+ */
+static uint8_t USART_ClockChange_Busy(void){
+	uint8_t i;
+
+	for(i = 0; i < 3; i++){
+		if(Global_USART_Config[i] == NULL)
+			continue;
+
+		if(Global_USART_DMA_TxBusy[i])
+			return 1;
+
+		if((Global_USART_Instance[i]->CR1 & USART_Mode_Tx) && !(Global_USART_Instance[i]->SR & USART_SR_TC))
+			return 1;
+	}
+
+	return 0;
+}
 
 /*******************************************************/
 
@@ -34,10 +209,13 @@ static USART_Config_t *Global_USART_Config[3] = {NULL, NULL, NULL};
  * @Parameter [in] 	- USARTx: where x can be 1/2/3 depending on device
  * @Parameter [in]	- UART_Config: All UART Configurations
  * @Return Value	- NONE
- * Note				- Supports For now ASYNCHRONOUS Mode & Clock 8 MHz
+ * Note				- Supports For now ASYNCHRONOUS Mode
+ * 					- BRR follows later clock changes made through the RCC driver, the governor waits
+ * 					  for the end of any transmission but not of a reception
  */
 void MCAL_USART_Init(USART_TypeDef *USARTx, USART_Config_t *USART_Config){
-	uint32_t pclk, BRR;
+	RCC_Clocks_t clocks;
+	USART_Handle_t *handle = &Global_USART_Handle[USART_INDEX(USARTx)];
 
 	/* enable clock for USARTx and set GLOBAL_UART_Config for USARTx used */
 	if(USARTx == USART1){
@@ -53,8 +231,8 @@ void MCAL_USART_Init(USART_TypeDef *USARTx, USART_Config_t *USART_Config){
 		Global_USART_Config[2] = USART_Config;
 	}
 
-	/* Enable USART Module */
-	USARTx->CR1 |= 1 << 13;
+	/* Enable USART Module >> Bit 13 UE */
+	BITBAND_PERIPH(USARTx->CR1, 13) = 1;
 
 	/* Specify Tx/Rx Enable/Disable based on @ref UART_Mode_Define */
 	USARTx->CR1 |= USART_Config->mode;
@@ -62,6 +240,18 @@ void MCAL_USART_Init(USART_TypeDef *USARTx, USART_Config_t *USART_Config){
 	/* Specify Payload Length */
 	USARTx->CR1 |= USART_Config->payloadLength;
 
+	/* Resolve the data masks used by the per-frame path */
+	if(USART_Config->payloadLength == USART_PayloadLength_9B){
+		handle->is9Bit = 1;
+		handle->txMask = 0x1FF;
+		handle->rxMask = (USART_Config->parity == USART_Parity_NONE) ? 0x1FF : 0xFF;
+	}
+	else{
+		handle->is9Bit = 0;
+		handle->txMask = 0xFF;
+		handle->rxMask = (USART_Config->parity == USART_Parity_NONE) ? 0xFF : 0x7F;
+	}
+
 	/* Specify Parity */
 	USARTx->CR1 |= USART_Config->parity;
 
@@ -71,26 +261,29 @@ void MCAL_USART_Init(USART_TypeDef *USARTx, USART_Config_t *USART_Config){
 	/* Specify HW Flow Control */
 	USARTx->CR3 |= USART_Config->HW_FlowCtl;
 
-	/* set BaudRate Register (BRR) */
-	/* PCLK1 For USART2 ,USART3 */
-	/* PCLK2 For USART1 */
+	/* set BaudRate Register (BRR) and keep it right on clock changes */
+	MCAL_RCC_GetClocks(&clocks);
+	USART_Set_BaudRate(USARTx, &clocks);
+	MCAL_RCC_Subscribe(USART_ClockChange_CallBack);
+	MCAL_RCC_AddBusyQuery(USART_ClockChange_Busy);
 
-	if(USARTx == USART1){
-		pclk = MCAL_RCC_GetPCLK2Freq();
-	}
-	else{
-		pclk = MCAL_RCC_GetPCLK1Freq();
-	}
+	/* Reset the RX ring buffer of this USART */
+	if(USART_Config->RxBuffer == USART_RxBuffer_ENABLE){
+		USART_RxRing_t *ring = &Global_USART_RxRing[USART_INDEX(USARTx)];
 
-	BRR = USART_BRR_REGISTER(pclk, USART_Config->baudRate);
+		ring->head = 0;
+		ring->tail = 0;
+		ring->stats.overrunCount = 0;
+		ring->stats.hwOverrunCount = 0;
+		ring->stats.highWaterMark = 0;
 
-	/* Bits 15:4 DIV_Mantissa[11:0]: mantissa of USARTDIV */
-	/* Bits 3:0 DIV_Fraction[3:0]: fraction of USARTDIV */
-	USARTx->BRR = BRR;
+		/* RXNE interrupt feeds the ring buffer */
+		USARTx->CR1 |= USART_IRQ_RXNE;
+	}
 
 	/* Enable or Disable Interrupt */
 	/* CR1 */
-	if(USART_Config->IRQ_EN != USART_IRQ_NONE)
+	if((USART_Config->IRQ_EN != USART_IRQ_NONE) || (USART_Config->RxBuffer == USART_RxBuffer_ENABLE))
 	{
 		USARTx->CR1 |= USART_Config->IRQ_EN;
 
@@ -112,6 +305,15 @@ void MCAL_USART_Init(USART_TypeDef *USARTx, USART_Config_t *USART_Config){
  * Note				- Reset the model by RCC
  */
 void MCAL_USART_DeInit(USART_TypeDef *USARTx){
+	uint8_t index = USART_INDEX(USARTx);
+
+	/* The RX DMA channel is not reset with the USART */
+	if(Global_USART_IdleRx[index].P_Frame_CallBack != NULL){
+		MCAL_DMA_Stop(Global_USART_DMA_RxChannel[index]);
+		MCAL_DMA_Release(Global_USART_DMA_RxChannel[index], USARTx);
+		Global_USART_IdleRx[index].P_Frame_CallBack = NULL;
+	}
+
 	if(USARTx == USART1){
 		RCC_USART1_CLK_RST();
 
@@ -147,101 +349,61 @@ void MCAL_USART_GPIO_Set_Pins(USART_TypeDef *USARTx){
 	 * USARTx_CTS: HwFlowCtl   : Input floating/ Input pull-up
 	 */
 
-	GPIO_PinConfig_t PinCfg;
+	GPIO_PinConfig_t PinCfg[2];
+	GPIO_TypeDef *GPIOx;
+	uint16_t outputPins, inputPins, RTS_Pin, CTS_Pin;
+	uint8_t index;
 
 	if(USARTx == USART1){
-		/* USART1_TX : PA9 */
-		PinCfg.pinNumber = GPIO_PIN_9;
-		PinCfg.mode = GPIO_MODE_OUTPUT_AF_PP;
-		PinCfg.outputSpeed = GPIO_SPEED_10M;
-		MCAL_GPIO_Init(GPIOA, &PinCfg);
-		/* USART1_Rx : PA10 */
-		PinCfg.pinNumber = GPIO_PIN_10;
-		PinCfg.mode = GPIO_MODE_INPUT_FLOATING;
-		MCAL_GPIO_Init(GPIOA, &PinCfg);
-
-		/* USART1_RTS: PA12 */
-		if(
-				(Global_USART_Config[0]->HW_FlowCtl == USART_HwFlowCtl_RTS) ||
-				(Global_USART_Config[0]->HW_FlowCtl == USART_HwFlowCtl_RTS_CTS)
-			){
-			PinCfg.pinNumber = GPIO_PIN_12;
-			PinCfg.mode = GPIO_MODE_OUTPUT_AF_PP;
-			MCAL_GPIO_Init(GPIOA, &PinCfg);
-		}
-
-		/* USART1_CTS: PA11 */
-		if(
-				(Global_USART_Config[0]->HW_FlowCtl == USART_HwFlowCtl_CTS) ||
-				(Global_USART_Config[0]->HW_FlowCtl == USART_HwFlowCtl_RTS_CTS)
-			){
-			PinCfg.pinNumber = GPIO_PIN_11;
-			PinCfg.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOA, &PinCfg);
-		}
+		/* USART1_TX : PA9, USART1_Rx : PA10, USART1_CTS: PA11, USART1_RTS: PA12 */
+		GPIOx = GPIOA;
+		index = 0;
+		outputPins = GPIO_PIN_9;
+		inputPins = GPIO_PIN_10;
+		CTS_Pin = GPIO_PIN_11;
+		RTS_Pin = GPIO_PIN_12;
 	}
 	else if(USARTx == USART2){
-		/* USART2_TX : PA2 */
-		PinCfg.pinNumber = GPIO_PIN_2;
-		PinCfg.mode = GPIO_MODE_OUTPUT_AF_PP;
-		PinCfg.outputSpeed = GPIO_SPEED_10M;
-		MCAL_GPIO_Init(GPIOA, &PinCfg);
-		/* USART2_Rx : PA3 */
-		PinCfg.pinNumber = GPIO_PIN_3;
-		PinCfg.mode = GPIO_MODE_INPUT_FLOATING;
-		MCAL_GPIO_Init(GPIOA, &PinCfg);
-
-		/* USART2_RTS: PA1 */
-		if(
-				(Global_USART_Config[1]->HW_FlowCtl == USART_HwFlowCtl_RTS) ||
-				(Global_USART_Config[1]->HW_FlowCtl == USART_HwFlowCtl_RTS_CTS)
-			){
-			PinCfg.pinNumber = GPIO_PIN_1;
-			PinCfg.mode = GPIO_MODE_OUTPUT_AF_PP;
-			MCAL_GPIO_Init(GPIOA, &PinCfg);
-		}
-
-		/* USART2_CTS: PA0 */
-		if(
-				(Global_USART_Config[1]->HW_FlowCtl == USART_HwFlowCtl_CTS) ||
-				(Global_USART_Config[1]->HW_FlowCtl == USART_HwFlowCtl_RTS_CTS)
-			){
-			PinCfg.pinNumber = GPIO_PIN_0;
-			PinCfg.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOA, &PinCfg);
-		}
+		/* USART2_TX : PA2, USART2_Rx : PA3, USART2_CTS: PA0, USART2_RTS: PA1 */
+		GPIOx = GPIOA;
+		index = 1;
+		outputPins = GPIO_PIN_2;
+		inputPins = GPIO_PIN_3;
+		CTS_Pin = GPIO_PIN_0;
+		RTS_Pin = GPIO_PIN_1;
 	}
 	else if(USARTx == USART3){
-		/* USART3_TX : PB10 */
-		PinCfg.pinNumber = GPIO_PIN_10;
-		PinCfg.mode = GPIO_MODE_OUTPUT_AF_PP;
-		PinCfg.outputSpeed = GPIO_SPEED_10M;
-		MCAL_GPIO_Init(GPIOB, &PinCfg);
-		/* USART3_Rx : PB11 */
-		PinCfg.pinNumber = GPIO_PIN_11;
-		PinCfg.mode = GPIO_MODE_INPUT_FLOATING;
-		MCAL_GPIO_Init(GPIOB, &PinCfg);
-
-		/* USART3_RTS: PB14 */
-		if(
-				(Global_USART_Config[2]->HW_FlowCtl == USART_HwFlowCtl_RTS) ||
-				(Global_USART_Config[2]->HW_FlowCtl == USART_HwFlowCtl_RTS_CTS)
-			){
-			PinCfg.pinNumber = GPIO_PIN_14;
-			PinCfg.mode = GPIO_MODE_OUTPUT_AF_PP;
-			MCAL_GPIO_Init(GPIOB, &PinCfg);
-		}
+		/* USART3_TX : PB10, USART3_Rx : PB11, USART3_CTS: PB13, USART3_RTS: PB14 */
+		GPIOx = GPIOB;
+		index = 2;
+		outputPins = GPIO_PIN_10;
+		inputPins = GPIO_PIN_11;
+		CTS_Pin = GPIO_PIN_13;
+		RTS_Pin = GPIO_PIN_14;
+	}
+	else{
+		return;
+	}
 
-		/* USART3_CTS: PB13 */
-		if(
-				(Global_USART_Config[2]->HW_FlowCtl == USART_HwFlowCtl_CTS) ||
-				(Global_USART_Config[2]->HW_FlowCtl == USART_HwFlowCtl_RTS_CTS)
-			){
-			PinCfg.pinNumber = GPIO_PIN_13;
-			PinCfg.mode = GPIO_MODE_INPUT_FLOATING;
-			MCAL_GPIO_Init(GPIOB, &PinCfg);
-		}
+	if(
+			(Global_USART_Config[index]->HW_FlowCtl == USART_HwFlowCtl_RTS) ||
+			(Global_USART_Config[index]->HW_FlowCtl == USART_HwFlowCtl_RTS_CTS)
+		){
+		outputPins |= RTS_Pin;
+	}
+
+	if(
+			(Global_USART_Config[index]->HW_FlowCtl == USART_HwFlowCtl_CTS) ||
+			(Global_USART_Config[index]->HW_FlowCtl == USART_HwFlowCtl_RTS_CTS)
+		){
+		inputPins |= CTS_Pin;
 	}
+
+	PinCfg[0] = (GPIO_PinConfig_t){outputPins, GPIO_MODE_OUTPUT_AF_PP, GPIO_SPEED_10M};
+	PinCfg[1] = (GPIO_PinConfig_t){inputPins, GPIO_MODE_INPUT_FLOATING, GPIO_SPEED_10M};
+
+	/* One store per configuration register */
+	MCAL_GPIO_InitPins(GPIOx, PinCfg, 2);
 }
 
 /*=====================================================================
@@ -250,17 +412,23 @@ void MCAL_USART_GPIO_Set_Pins(USART_TypeDef *USARTx){
  * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
  * @param [in] 		- pTxBuffer: Buffer that contains that data will be transmitted
  * @param [in] 		- Polling_mechanism: Enable Polling or Disable it
- * @retval			- none
+ * @retval			- MCAL_OK, MCAL_TIMEOUT if TXE is not set within USART_TIMEOUT_DEFAULT (nothing is sent)
  * Note				- Should init USART firstly
  */
-void MCAL_USART_SendData(USART_TypeDef *USARTx, uint16_t *pTxBuffer, enum Polling_mechanism PollingEn){
+MCAL_Status_t MCAL_USART_SendData(USART_TypeDef *USARTx, uint16_t *pTxBuffer, enum Polling_mechanism PollingEn){
 	if(PollingEn == enable){
+		DWT_Timeout_t timer;
+
 		/* Wait until TXE flag is set */
 
 		/*Bit 7 TXE: Transmit data register empty
 		This bit is set by hardware when the content of the TDR register has been transferred into the shift register
 		It is cleared by a write to the USART_DR register.*/
-		while( !(USARTx->SR & 1 << 7) );
+		MCAL_DWT_Timeout_Start(&timer, USART_TIMEOUT_DEFAULT);
+		while( !(USARTx->SR & 1 << 7) ){
+			if(DWT_TIMEOUT_EXPIRED(timer))
+				return MCAL_TIMEOUT;
+		}
 	}
 
 	/* Check the contents of USART Payload length is 8B or 9B in a frame */
@@ -268,31 +436,10 @@ void MCAL_USART_SendData(USART_TypeDef *USARTx, uint16_t *pTxBuffer, enum Pollin
 	the value written in the MSB (bit 7 or bit 8 depending on the data length) has no effect
 	because it is replaced by the parity.*/
 
-	/* check if it USART1, USART2 or USART3 */
-	if(USARTx == USART1){
-		if(Global_USART_Config[0]->payloadLength == USART_PayloadLength_9B){
-			USARTx->DR = (*pTxBuffer & 0x1FF);
-		}
-		else{
-			USARTx->DR = (*pTxBuffer & (uint8_t)0xFF);
-		}
-	}
-	else if(USARTx == USART2){
-		if(Global_USART_Config[1]->payloadLength == USART_PayloadLength_9B){
-			USARTx->DR = (*pTxBuffer & 0x1FF);
-		}
-		else{
-			USARTx->DR = (*pTxBuffer & (uint8_t)0xFF);
-		}
-	}
-	else if(USARTx == USART3){
-		if(Global_USART_Config[2]->payloadLength == USART_PayloadLength_9B){
-			USARTx->DR = (*pTxBuffer & 0x1FF);
-		}
-		else{
-			USARTx->DR = (*pTxBuffer & (uint8_t)0xFF);
-		}
-	}
+	/* Mask resolved once in MCAL_USART_Init() (0x1FF for 9B payload, 0xFF for 8B payload) */
+	USARTx->DR = (*pTxBuffer & Global_USART_Handle[USART_INDEX(USARTx)].txMask);
+
+	return MCAL_OK;
 }
 
 /*=====================================================================
@@ -301,112 +448,412 @@ void MCAL_USART_SendData(USART_TypeDef *USARTx, uint16_t *pTxBuffer, enum Pollin
  * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
  * @param [in] 		- pRxBuffer: Buffer that contains that data will be received
  * @param [in] 		- Polling_mechanism: Enable Polling or Disable it
- * @retval			- none
+ * @retval			- MCAL_OK, MCAL_TIMEOUT if RXNE is not set within USART_TIMEOUT_DEFAULT (pRxBuffer untouched)
  * Note				- Should init USART firstly
  */
-void MCAL_USART_ReceiveData(USART_TypeDef *USARTx, uint16_t *pRxBuffer, enum Polling_mechanism PollingEn){
+MCAL_Status_t MCAL_USART_ReceiveData(USART_TypeDef *USARTx, uint16_t *pRxBuffer, enum Polling_mechanism PollingEn){
 	/* Wait until */
 	/* Bit 5 RXNE: Read data register not empty
 	This bit is set by hardware when the content of the RDR shift register has been transferred to the USART_DR register */
-	if(PollingEn == enable)
-		while(!(USARTx->SR & 1 << 5));
+	if(PollingEn == enable){
+		DWT_Timeout_t timer;
+
+		MCAL_DWT_Timeout_Start(&timer, USART_TIMEOUT_DEFAULT);
+		while(!(USARTx->SR & 1 << 5)){
+			if(DWT_TIMEOUT_EXPIRED(timer))
+				return MCAL_TIMEOUT;
+		}
+	}
 
-	/* Check the contents of USART Payload length is 8B or 9B in a frame */
 	/* When receiving with the parity enabled, the value read in the MSB bit is the received parity bit. */
+	/* Mask resolved once in MCAL_USART_Init():
+	 * 9B payload: 0x1FF (no parity) / 0xFF (parity)
+	 * 8B payload: 0xFF  (no parity) / 0x7F (parity)
+	 */
+	*pRxBuffer = (uint16_t)(USARTx->DR & Global_USART_Handle[USART_INDEX(USARTx)].rxMask);
+
+	return MCAL_OK;
+}
+
+/*=====================================================================
+ * @Fn				- MCAL_USART_Wait_Tc
+ * @brief 			- Wait until The TC flag is Set
+ * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
+ * @retval			- MCAL_OK, MCAL_TIMEOUT if TC is not set within USART_TIMEOUT_DEFAULT
+ * Note				- none
+ */
+MCAL_Status_t MCAL_USART_Wait_Tc(USART_TypeDef *USARTx){
+	DWT_Timeout_t timer;
+
+	/* Bit 6 TC: Transmission complete
+	This bit is set by hardware if the transmission of a frame containing data is complete */
+	MCAL_DWT_Timeout_Start(&timer, USART_TIMEOUT_DEFAULT);
+	while( !(USARTx->SR & 1 << 6) ){
+		if(DWT_TIMEOUT_EXPIRED(timer))
+			return MCAL_TIMEOUT;
+	}
+
+	return MCAL_OK;
+}
+
+/*=====================================================================
+ * @Fn				- MCAL_USART_SendBuffer_DMA
+ * @brief 			- Send a whole buffer on USART by DMA1 without copying it
+ * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
+ * @param [in] 		- pTxBuffer: Buffer that contains the bytes to be transmitted (handed to DMA as is)
+ * @param [in] 		- length: number of bytes to be transmitted (1..65535)
+ * @param [in] 		- P_TxCplt_CallBack: called from the DMA interrupt with MCAL_OK once the last byte is loaded into DR,
+ * 					  or with MCAL_ERROR on a DMA transfer error (channel stopped and released) (can be NULL)
+ * @retval			- MCAL_OK if the transfer started, MCAL_BUSY if a previous DMA transfer is still running
+ * 					  on this USART or its channel is claimed by another driver, MCAL_ERROR on wrong parameters
+ * Note				- Should init USART firstly (8-bit payload)
+ * 					- pTxBuffer must stay valid and unchanged until the callback is called
+ * 					- The callback means DR is loaded with the last byte, call MCAL_USART_Wait_Tc()
+ * 					  if the line must be idle (e.g. before disabling the USART)
+ */
+MCAL_Status_t MCAL_USART_SendBuffer_DMA(USART_TypeDef *USARTx, const uint8_t *pTxBuffer, uint16_t length, void (* P_TxCplt_CallBack)(MCAL_Status_t status)){
+	DMA_Config_t DMA_Cfg;
+	uint8_t index;
+
 	if(USARTx == USART1){
-		if(Global_USART_Config[0]->payloadLength == USART_PayloadLength_9B){
-			/* No parity in a frame */
-			if(Global_USART_Config[0]->parity == USART_Parity_NONE){
-				/* No parity ,so all 9bits are considered as data */
-				*((uint16_t*)pRxBuffer) = USARTx->DR;
-			}
-			/* Parity in a frame */
-			else{
-				/* Parity is used, so, 8bits will be of user data and 1 bit is parity */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0xFF);
+		index = 0;
+		DMA_Cfg.P_IRQ_CallBack = USART1_DMA_Tx_CallBack;
+	}
+	else if(USARTx == USART2){
+		index = 1;
+		DMA_Cfg.P_IRQ_CallBack = USART2_DMA_Tx_CallBack;
+	}
+	else if(USARTx == USART3){
+		index = 2;
+		DMA_Cfg.P_IRQ_CallBack = USART3_DMA_Tx_CallBack;
+	}
+	else{
+		return MCAL_ERROR;
+	}
+
+	if((pTxBuffer == NULL) || (length == 0))
+		return MCAL_ERROR;
+
+	if(Global_USART_DMA_TxBusy[index])
+		return MCAL_BUSY;
+
+	if(MCAL_DMA_Claim(Global_USART_DMA_TxChannel[index], USARTx) != MCAL_OK)
+		return MCAL_BUSY;
+
+	Global_USART_DMA_TxBusy[index] = 1;
+	Global_USART_DMA_TxCplt_CallBack[index] = P_TxCplt_CallBack;
+
+	/* Memory (byte, incremented) --> USARTx->DR (byte, fixed) */
+	DMA_Cfg.direction = DMA_Direction_MemToPeriph;
+	DMA_Cfg.priority = DMA_Priority_Medium;
+	DMA_Cfg.periphSize = DMA_PeriphSize_8bits;
+	DMA_Cfg.memSize = DMA_MemSize_8bits;
+	DMA_Cfg.periphInc = DMA_PeriphInc_Disable;
+	DMA_Cfg.memInc = DMA_MemInc_Enable;
+	DMA_Cfg.mode = DMA_Mode_Normal;
+	DMA_Cfg.IRQ_EN = DMA_IRQ_TC | DMA_IRQ_TE;
+	MCAL_DMA_Init(Global_USART_DMA_TxChannel[index], &DMA_Cfg);
+
+	/* Clear TC so it reflects the end of this buffer (rc_w0: writing 1 to the other flags keeps them) */
+	USARTx->SR = ~(USART_SR_TC);
+
+	MCAL_DMA_Start(Global_USART_DMA_TxChannel[index], (uint32_t)&USARTx->DR, (uint32_t)pTxBuffer, length);
+
+	/* Let TXE requests drive the DMA channel */
+	USARTx->CR3 |= USART_CR3_DMAT;
+
+	return MCAL_OK;
+}
+
+/*=====================================================================
+ * @Fn				- MCAL_USART_ReceiveToIdle_DMA
+ * @brief 			- Receive variable length frames by circular DMA, delimited by the IDLE line interrupt
+ * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
+ * @param [in] 		- pRxBuffer: caller circular buffer written by DMA1 (used as is, no copy)
+ * @param [in] 		- length: size of pRxBuffer in bytes (1..65535)
+ * @param [in] 		- P_Frame_CallBack: called from the USART interrupt once per frame with the frame offset
+ * 					  and length inside pRxBuffer, the frame bytes are pRxBuffer[(offset + i) % length]
+ * @retval			- MCAL_OK if reception started, MCAL_ERROR on wrong parameters or if @RxBuffer is enabled,
+ * 					  MCAL_BUSY if the RX channel is claimed by another driver
+ * Note				- Should init USART firstly (8-bit payload, @RxBuffer = USART_RxBuffer_DISABLE)
+ * 					- Frames must be shorter than length and consumed before the DMA wraps over them
+ * 					- A governor profile switch is not held back by the reception, characters arriving
+ * 					  while BRR is reprogrammed can be lost
+ */
+MCAL_Status_t MCAL_USART_ReceiveToIdle_DMA(USART_TypeDef *USARTx, uint8_t *pRxBuffer, uint16_t length, void (* P_Frame_CallBack)(uint16_t offset, uint16_t length)){
+	uint8_t index = USART_INDEX(USARTx);
+	USART_IdleRx_t *idleRx = &Global_USART_IdleRx[index];
+	DMA_Config_t DMA_Cfg;
+
+	if((pRxBuffer == NULL) || (length == 0) || (P_Frame_CallBack == NULL))
+		return MCAL_ERROR;
+
+	/* RXNE interrupt of the ring buffer would steal DR from the DMA */
+	if(Global_USART_Config[index]->RxBuffer == USART_RxBuffer_ENABLE)
+		return MCAL_ERROR;
+
+	if(MCAL_DMA_Claim(Global_USART_DMA_RxChannel[index], USARTx) != MCAL_OK)
+		return MCAL_BUSY;
+
+	idleRx->length = length;
+	idleRx->lastPos = 0;
+	idleRx->P_Frame_CallBack = P_Frame_CallBack;
+
+	/* USARTx->DR (byte, fixed) --> caller buffer (byte, incremented), wraps forever */
+	DMA_Cfg.direction = DMA_Direction_PeriphToMem;
+	DMA_Cfg.priority = DMA_Priority_High;
+	DMA_Cfg.periphSize = DMA_PeriphSize_8bits;
+	DMA_Cfg.memSize = DMA_MemSize_8bits;
+	DMA_Cfg.periphInc = DMA_PeriphInc_Disable;
+	DMA_Cfg.memInc = DMA_MemInc_Enable;
+	DMA_Cfg.mode = DMA_Mode_Circular;
+	/* No DMA interrupt: frames are cut by IDLE, the NVIC line of the channel is not touched */
+	DMA_Cfg.IRQ_EN = DMA_IRQ_NONE;
+	DMA_Cfg.P_IRQ_CallBack = NULL;
+	MCAL_DMA_Init(Global_USART_DMA_RxChannel[index], &DMA_Cfg);
+	MCAL_DMA_Start(Global_USART_DMA_RxChannel[index], (uint32_t)&USARTx->DR, (uint32_t)pRxBuffer, length);
+
+	/* Clear a pending IDLE flag (read SR then DR) */
+	(void)USARTx->SR;
+	(void)USARTx->DR;
+
+	USARTx->CR3 |= USART_CR3_DMAR;
+	USARTx->CR1 |= USART_IRQ_IDLE;
+
+	/* Enable NVIC Interrupt */
+	if(USARTx == USART1)
+		NVIC_IRQ37_USART1_ENABLE();
+	else if(USARTx == USART2)
+		NVIC_IRQ38_USART2_ENABLE();
+	else if(USARTx == USART3)
+		NVIC_IRQ39_USART3_ENABLE();
+
+	return MCAL_OK;
+}
+
+/*=====================================================================
+ * @Fn				- MCAL_USART_StopReceive_DMA
+ * @brief 			- Stop the idle-line framed reception started by MCAL_USART_ReceiveToIdle_DMA()
+ * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
+ * @retval			- none
+ * Note				- Bytes of an unfinished frame are dropped
+ */
+void MCAL_USART_StopReceive_DMA(USART_TypeDef *USARTx){
+	uint8_t index = USART_INDEX(USARTx);
+
+	/* Keep IDLEIE if the application asked for it in @IRQ_EN */
+	if(!(Global_USART_Config[index]->IRQ_EN & USART_IRQ_IDLE))
+		USARTx->CR1 &= ~(USART_IRQ_IDLE);
+
+	USARTx->CR3 &= ~(USART_CR3_DMAR);
+	MCAL_DMA_Stop(Global_USART_DMA_RxChannel[index]);
+	MCAL_DMA_Release(Global_USART_DMA_RxChannel[index], USARTx);
+
+	Global_USART_IdleRx[index].P_Frame_CallBack = NULL;
+}
+
+/*=====================================================================
+ * @Fn				- MCAL_USART_Write
+ * @brief 			- Send a block of frames on USART (polling)
+ * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
+ * @param [in] 		- pTxBuffer: frames to be sent, uint8_t per frame for 8-bit payload / uint16_t per frame for 9-bit payload
+ * @param [in] 		- length: number of frames to be sent
+ * @param [in] 		- timeout: maximum time of the whole call in ms (USART_TIMEOUT_MAX: wait forever)
+ * @retval			- number of frames written to DR (less than length on timeout)
+ * Note				- Should init USART firstly
+ * 					- Returns once the last frame is in DR, call MCAL_USART_Wait_Tc() if the line must be idle
+ */
+size_t MCAL_USART_Write(USART_TypeDef *USARTx, const void *pTxBuffer, size_t length, uint32_t timeout){
+	USART_Handle_t *handle = &Global_USART_Handle[USART_INDEX(USARTx)];
+	DWT_Timeout_t timer;
+	size_t i;
+
+	MCAL_DWT_Timeout_Start(&timer, timeout);
+
+	if(handle->is9Bit){
+		const uint16_t *pSrc = (const uint16_t *)pTxBuffer;
+		for(i = 0; i < length; i++){
+			while(!(USARTx->SR & USART_SR_TXE)){
+				if(DWT_TIMEOUT_EXPIRED(timer))
+					return i;
 			}
+			USARTx->DR = (pSrc[i] & 0x1FF);
 		}
-		/* Payload length is 8B in a frame */
-		else{
-			/* No parity in a frame */
-			if(Global_USART_Config[0]->parity == USART_Parity_NONE){
-				/* No parity ,so all 8bits are considered as data */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0xFF);
-			}
-			/* Parity in a frame */
-			else{
-				/* Parity is used, so, 7bits will be of user data and 1 bit is parity */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0x7F);
+	}
+	else{
+		const uint8_t *pSrc = (const uint8_t *)pTxBuffer;
+		for(i = 0; i < length; i++){
+			while(!(USARTx->SR & USART_SR_TXE)){
+				if(DWT_TIMEOUT_EXPIRED(timer))
+					return i;
 			}
+			USARTx->DR = pSrc[i];
 		}
 	}
-	else if(USARTx == USART2){
-		if(Global_USART_Config[1]->payloadLength == USART_PayloadLength_9B){
-			/* No parity in a frame */
-			if(Global_USART_Config[1]->parity == USART_Parity_NONE){
-				/* No parity ,so all 9bits are considered as data */
-				*((uint16_t*)pRxBuffer) = USARTx->DR;
+
+	return length;
+}
+
+/*=====================================================================
+ * @Fn				- MCAL_USART_Read
+ * @brief 			- Receive a block of frames from USART
+ * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
+ * @param [out] 	- pRxBuffer: destination, uint8_t per frame for 8-bit payload / uint16_t per frame for 9-bit payload
+ * @param [in] 		- length: number of frames to be received
+ * @param [in] 		- timeout: maximum time of the whole call in ms (0: only take what is already received,
+ * 					  USART_TIMEOUT_MAX: wait forever)
+ * @retval			- number of frames received (less than length on timeout)
+ * Note				- Should init USART firstly
+ * 					- With @RxBuffer = USART_RxBuffer_ENABLE frames are taken from the ring buffer filled by
+ * 					  the RXNE interrupt (never disables interrupts, single consumer only), otherwise RXNE is polled
+ */
+size_t MCAL_USART_Read(USART_TypeDef *USARTx, void *pRxBuffer, size_t length, uint32_t timeout){
+	uint8_t index = USART_INDEX(USARTx);
+	USART_Handle_t *handle = &Global_USART_Handle[index];
+	DWT_Timeout_t timer;
+	size_t count = 0;
+
+	MCAL_DWT_Timeout_Start(&timer, timeout);
+
+	if(Global_USART_Config[index]->RxBuffer == USART_RxBuffer_ENABLE){
+		USART_RxRing_t *ring = &Global_USART_RxRing[index];
+
+		for(;;){
+			uint16_t tail = ring->tail;
+			size_t available = (uint16_t)(ring->head - tail);
+			size_t i;
+
+			if(available > (length - count))
+				available = length - count;
+
+			if(handle->is9Bit){
+				uint16_t *pDst = (uint16_t *)pRxBuffer + count;
+				for(i = 0; i < available; i++)
+					pDst[i] = ring->frames[(uint16_t)(tail + i) & USART_RX_BUFFER_MASK];
 			}
-			/* Parity in a frame */
 			else{
-				/* Parity is used, so, 8bits will be of user data and 1 bit is parity */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0xFF);
+				uint8_t *pDst = (uint8_t *)pRxBuffer + count;
+				for(i = 0; i < available; i++)
+					pDst[i] = (uint8_t)ring->frames[(uint16_t)(tail + i) & USART_RX_BUFFER_MASK];
 			}
+
+			/* Release the slots to the ISR only after they have been copied */
+			ring->tail = tail + (uint16_t)available;
+			count += available;
+
+			if((count == length) || DWT_TIMEOUT_EXPIRED(timer))
+				break;
 		}
-		/* Payload length is 8B in a frame */
-		else{
-			/* No parity in a frame */
-			if(Global_USART_Config[1]->parity == USART_Parity_NONE){
-				/* No parity ,so all 8bits are considered as data */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0xFF);
+	}
+	else if(handle->is9Bit){
+		uint16_t *pDst = (uint16_t *)pRxBuffer;
+		for(; count < length; count++){
+			while(!(USARTx->SR & USART_SR_RXNE)){
+				if(DWT_TIMEOUT_EXPIRED(timer))
+					return count;
 			}
-			/* Parity in a frame */
-			else{
-				/* Parity is used, so, 7bits will be of user data and 1 bit is parity */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0x7F);
+			pDst[count] = (uint16_t)(USARTx->DR & handle->rxMask);
+		}
+	}
+	else{
+		uint8_t *pDst = (uint8_t *)pRxBuffer;
+		for(; count < length; count++){
+			while(!(USARTx->SR & USART_SR_RXNE)){
+				if(DWT_TIMEOUT_EXPIRED(timer))
+					return count;
 			}
+			pDst[count] = (uint8_t)(USARTx->DR & handle->rxMask);
 		}
 	}
-	else if(USARTx == USART3){
-		if(Global_USART_Config[2]->payloadLength == USART_PayloadLength_9B){
-			/* No parity in a frame */
-			if(Global_USART_Config[2]->parity == USART_Parity_NONE){
-				/* No parity ,so all 9bits are considered as data */
-				*((uint16_t*)pRxBuffer) = USARTx->DR;
+
+	return count;
+}
+
+/*=====================================================================
+ * @Fn				- MCAL_USART_GetRxStats
+ * @brief 			- Get the ring buffer overrun and high-water-mark counters
+ * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
+ * @param [out] 	- pStats: counters of this USART since MCAL_USART_Init()
+ * @retval			- none
+ * Note				- Use it to check if USART_RX_BUFFER_SIZE fits the application
+ */
+void MCAL_USART_GetRxStats(USART_TypeDef *USARTx, USART_RxStats_t *pStats){
+	*pStats = Global_USART_RxRing[USART_INDEX(USARTx)].stats;
+}
+
+/*******************************************************/
+
+/*******************************************************/
+/****************** ISR Functions **********************/
+/*******************************************************/
+static void USART_IRQ_Handler(uint8_t index, USART_TypeDef *USARTx){
+	USART_Config_t *USART_Config = Global_USART_Config[index];
+
+	if(USART_Config->RxBuffer == USART_RxBuffer_ENABLE){
+		uint32_t sr = USARTx->SR;
+
+		if(sr & (USART_SR_RXNE | USART_SR_ORE)){
+			USART_RxRing_t *ring = &Global_USART_RxRing[index];
+			uint16_t head = ring->head;
+			uint16_t level = (uint16_t)(head - ring->tail);
+
+			/* Reading DR after SR clears both RXNE and ORE */
+			uint16_t frame = (uint16_t)(USARTx->DR & Global_USART_Handle[index].rxMask);
+
+			if(sr & USART_SR_ORE)
+				ring->stats.hwOverrunCount++;
+
+			if(level == USART_RX_BUFFER_SIZE){
+				ring->stats.overrunCount++;
 			}
-			/* Parity in a frame */
 			else{
-				/* Parity is used, so, 8bits will be of user data and 1 bit is parity */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0xFF);
+				ring->frames[head & USART_RX_BUFFER_MASK] = frame;
+				ring->head = head + 1;
+
+				if(++level > ring->stats.highWaterMark)
+					ring->stats.highWaterMark = level;
 			}
 		}
-		/* Payload length is 8B in a frame */
-		else{
-			/* No parity in a frame */
-			if(Global_USART_Config[2]->parity == USART_Parity_NONE){
-				/* No parity ,so all 8bits are considered as data */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0xFF);
-			}
-			/* Parity in a frame */
-			else{
-				/* Parity is used, so, 7bits will be of user data and 1 bit is parity */
-				*((uint16_t*)pRxBuffer) = (USARTx->DR & (uint8_t)0x7F);
+	}
+
+	if(Global_USART_IdleRx[index].P_Frame_CallBack != NULL){
+		USART_IdleRx_t *idleRx = &Global_USART_IdleRx[index];
+
+		if(USARTx->SR & USART_SR_IDLE){
+			uint16_t pos;
+
+			/* IDLE is cleared by reading SR then DR (the DMA has already taken the data) */
+			(void)USARTx->DR;
+
+			/* Current DMA write position, CNDTR is reloaded to length in circular mode */
+			pos = idleRx->length - MCAL_DMA_GetRemaining(Global_USART_DMA_RxChannel[index]);
+			if(pos == idleRx->length)
+				pos = 0;
+
+			if(pos != idleRx->lastPos){
+				uint16_t frameLength = (pos > idleRx->lastPos) ?
+						(pos - idleRx->lastPos) : (idleRx->length - idleRx->lastPos + pos);
+
+				idleRx->P_Frame_CallBack(idleRx->lastPos, frameLength);
+				idleRx->lastPos = pos;
 			}
 		}
 	}
+
+	if(USART_Config->P_IRQ_CallBack != NULL)
+		USART_Config->P_IRQ_CallBack();
 }
 
-/*=====================================================================
- * @Fn				- MCAL_USART_Wait_Tc
- * @brief 			- Wait until The TC flag is Set
- * @param [in] 		- USARTx: where x can be (1..3 depending on device used) to select the USART peripheral
- * @retval			- none
- * Note				- none
- */
-void MCAL_USART_Wait_Tc(USART_TypeDef *USARTx){
-	/* Bit 6 TC: Transmission complete
-	This bit is set by hardware if the transmission of a frame containing data is complete */
-	while( !(USARTx->SR & 1 << 6) );
+void USART1_IRQHandler(void){
+	USART_IRQ_Handler(0, USART1);
+}
+
+void USART2_IRQHandler(void){
+	USART_IRQ_Handler(1, USART2);
+}
+
+void USART3_IRQHandler(void){
+	USART_IRQ_Handler(2, USART3);
 }
 
 /*******************************************************/
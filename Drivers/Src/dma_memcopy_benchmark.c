@@ -0,0 +1,145 @@
+/*
+ * dma_memcopy_benchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ *
+ * On target measure of memcpy() against MCAL_DMA_MemCopy(), to find the block size above which
+ * the DMA engine is worth its setup cost.
+ *
+ * Sizes: 64, 128, 256, 512, 1024, 2048, 4096 and 8192 bytes.
+ * Each size is timed with DWT_CYCCNT (HCLK cycles):
+ * 		cpuCycles		: memcpy()
+ * 		dmaSetupCycles	: MCAL_DMA_MemCopy() call only (CPU time the DMA path costs)
+ * 		dmaTotalCycles	: MCAL_DMA_MemCopy() until MCAL_DMA_MemIsBusy() reads 0 (completion latency)
+ *
+ * The C6 has 10 KiB of SRAM, so by default the source is an 8 KiB table in flash and only the
+ * destination is in SRAM. Define DMA_BENCH_SRC_IN_RAM to 1 (with DMA_BENCH_MAX_LENGTH 2048 on the C6)
+ * to time SRAM to SRAM copies.
+ *
+ * Call DMA_MemCopy_Benchmark() from main() with no other DMA traffic and read the results in the debugger.
+ */
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include <string.h>
+#include "STM32F103x8_DMA_Driver.h"
+#include "STM32F103x8_DWT_Driver.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/***************** Generic Variables *******************/
+/*******************************************************/
+#ifndef DMA_BENCH_MAX_LENGTH
+#define DMA_BENCH_MAX_LENGTH				8192
+#endif
+
+#ifndef DMA_BENCH_SRC_IN_RAM
+#define DMA_BENCH_SRC_IN_RAM				0
+#endif
+
+#define DMA_BENCH_MIN_LENGTH				64
+#define DMA_BENCH_POINTS					8			/* 64 B .. 8 KiB, doubling */
+#define DMA_BENCH_TIMEOUT_MS				10
+
+typedef struct{
+	uint16_t length;
+	uint32_t cpuCycles;
+	uint32_t dmaSetupCycles;
+	uint32_t dmaTotalCycles;
+} DMA_Bench_Result_t;
+
+#if DMA_BENCH_SRC_IN_RAM
+static uint32_t DMA_Bench_Src[DMA_BENCH_MAX_LENGTH / 4];
+#else
+static const uint32_t DMA_Bench_Src[DMA_BENCH_MAX_LENGTH / 4] = {0x01234567, 0x89ABCDEF, 0xDEADBEEF, 0x5A5AA5A5};
+#endif
+
+static uint32_t DMA_Bench_Dst[DMA_BENCH_MAX_LENGTH / 4];
+
+/* Filled by DMA_MemCopy_Benchmark(), watch it in the debugger */
+DMA_Bench_Result_t DMA_Bench_Results[DMA_BENCH_POINTS];
+
+/*******************************************************/
+
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
+/**===============================================================================================
+ * @FName			- DMA_Bench_Run
+ * @Brief 			- Times one block size with both copy paths
+ * @Parameter [in] 	- length: bytes to copy
+ * @Parameter [out] - pResult: measured cycles
+ * @Return Value	- MCAL_OK, MCAL_BUSY (DMA engine not free), MCAL_TIMEOUT or MCAL_ERROR (wrong copy)
+ * Note				- The destination is cleared before each path, outside the timed window
+ */
+static MCAL_Status_t DMA_Bench_Run(uint16_t length, DMA_Bench_Result_t *pResult){
+	DWT_Timeout_t timer;
+	uint32_t start, setup;
+
+	pResult->length = length;
+
+	memset(DMA_Bench_Dst, 0, length);
+	start = DWT_CYCCNT;
+	memcpy(DMA_Bench_Dst, DMA_Bench_Src, length);
+	pResult->cpuCycles = DWT_CYCCNT - start;
+
+	if(memcmp(DMA_Bench_Dst, DMA_Bench_Src, length) != 0)
+		return MCAL_ERROR;
+
+	memset(DMA_Bench_Dst, 0, length);
+	MCAL_DWT_Timeout_Start(&timer, DMA_BENCH_TIMEOUT_MS);
+	start = DWT_CYCCNT;
+	if(MCAL_DMA_MemCopy(DMA_Bench_Dst, DMA_Bench_Src, length, NULL) != MCAL_OK)
+		return MCAL_BUSY;
+	setup = DWT_CYCCNT;
+	while(MCAL_DMA_MemIsBusy()){
+		if(DWT_TIMEOUT_EXPIRED(timer))
+			return MCAL_TIMEOUT;
+	}
+	pResult->dmaTotalCycles = DWT_CYCCNT - start;
+	pResult->dmaSetupCycles = setup - start;
+
+	if(memcmp(DMA_Bench_Dst, DMA_Bench_Src, length) != 0)
+		return MCAL_ERROR;
+
+	return MCAL_OK;
+}
+
+/*******************************************************/
+
+/**================================================================
+ * @Fn				- DMA_MemCopy_Benchmark
+ * @brief 			- Times memcpy() and MCAL_DMA_MemCopy() from 64 B to DMA_BENCH_MAX_LENGTH into DMA_Bench_Results
+ * @param [out] 	- pCrossover: first length where the DMA copy completes before memcpy() (0 if none)
+ * @retval 			- MCAL_OK, else the status of the failing size (see DMA_Bench_Run)
+ * Note				- dmaSetupCycles against cpuCycles is the crossover for the CPU time saved,
+ * 					  the one returned is the stricter one (DMA completion against memcpy())
+ */
+MCAL_Status_t DMA_MemCopy_Benchmark(uint16_t *pCrossover){
+	MCAL_Status_t status;
+	uint32_t length = DMA_BENCH_MIN_LENGTH;
+	uint16_t i;
+
+	MCAL_DWT_Init();
+
+#if DMA_BENCH_SRC_IN_RAM
+	for(i = 0; i < (DMA_BENCH_MAX_LENGTH / 4); i++)
+		DMA_Bench_Src[i] = 0x01234567UL * (i + 1);
+#endif
+
+	*pCrossover = 0;
+
+	for(i = 0; (i < DMA_BENCH_POINTS) && (length <= DMA_BENCH_MAX_LENGTH); i++, length <<= 1){
+		status = DMA_Bench_Run((uint16_t)length, &DMA_Bench_Results[i]);
+		if(status != MCAL_OK)
+			return status;
+
+		if((*pCrossover == 0) && (DMA_Bench_Results[i].dmaTotalCycles < DMA_Bench_Results[i].cpuCycles))
+			*pCrossover = (uint16_t)length;
+	}
+
+	return MCAL_OK;
+}
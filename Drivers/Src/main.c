@@ -22,6 +22,7 @@
 #endif
 
 #include "STM32F103x8_GPIO_Driver.h"
+#include "STM32F103x8_DEBOUNCE_Driver.h"
 
 void clockInit(){
 	RCC_GPIOA_CLK_EN(); /* Enable IOPA */
@@ -29,46 +30,49 @@ void clockInit(){
 }
 
 void GPIO_Init(){
-	GPIO_PinConfig_t *PinConfig = NULL;
+	const GPIO_PinConfig_t ButtonConfigs[] = {
+		/* PA1, PA13 input HighZ floating input (reset value) */
+		{ GPIO_PIN_1 | GPIO_PIN_13, GPIO_MODE_INPUT_FLOATING, 0 },
+	};
+	const GPIO_PinConfig_t LedConfigs[] = {
+		/* PB1, PB13 output push pull mode */
+		{ GPIO_PIN_1 | GPIO_PIN_13, GPIO_MODE_OUTPUT_PP, GPIO_SPEED_10M },
+	};
 
-	/* PA1 input HighZ floating input (reset value) */
-	PinConfig->pinNumber = GPIO_PIN_1;
-	PinConfig->mode = GPIO_MODE_INPUT_FLOATING;
-	MCAL_GPIO_Init(GPIOA, PinConfig);
-
-	/* PA13 input HighZ floating input (reset value) */
-	PinConfig->pinNumber = GPIO_PIN_13;
-	MCAL_GPIO_Init(GPIOA, PinConfig);
+	MCAL_GPIO_InitPins(GPIOA, ButtonConfigs, 1);
+	MCAL_GPIO_InitPins(GPIOB, LedConfigs, 1);
+}
 
-	/* PB1 output push pull mode */
-	PinConfig->pinNumber = GPIO_PIN_1;
-	PinConfig->mode = GPIO_MODE_OUTPUT_PP;
-	PinConfig->outputSpeed = GPIO_SPEED_10M;
-	MCAL_GPIO_Init(GPIOB, PinConfig);
+void Debounce_Init(){
+	const Debounce_Config_t DebounceConfig = {
+		.Tick_ms = 5,			/* 4 equal samples: 20 ms debounce */
+		.LongPress_ms = 500,
+		.TickSource = Debounce_TickSource_SysTick,
+	};
 
-	/* PB13 output push pull mode */
-	PinConfig->pinNumber = GPIO_PIN_13;
-	PinConfig->mode = GPIO_MODE_OUTPUT_PP;
-	MCAL_GPIO_Init(GPIOB, PinConfig);
-}
+	MCAL_Debounce_Init(&DebounceConfig);
 
-void myWait(){
-	for (int i = 0; i < 50000; i++);
+	/* PA1 button pulls low, PA13 button pulls high */
+	MCAL_Debounce_AddPort(GPIOA, GPIO_PIN_1 | GPIO_PIN_13, GPIO_PIN_1);
 }
 
 int main(void)
 {
+	Debounce_Event_t event;
+
 	clockInit();
 	GPIO_Init();
+	Debounce_Init();
 	while(1){
-		if (MCAL_GPIO_ReadPin(GPIOA, GPIO_PIN_1) == 0){
-			MCAL_GPIO_TogglePin(GPIOB, GPIO_PIN_1);
-			while (MCAL_GPIO_ReadPin(GPIOA, GPIO_PIN_1) == 0); /* Single Press */
-		}
-		if (MCAL_GPIO_ReadPin(GPIOA, GPIO_PIN_13) == 1){
-			MCAL_GPIO_TogglePin(GPIOB, GPIO_PIN_13); /* Multiple Press */
+		while(MCAL_Debounce_GetEvent(&event)){
+			if(event.pin == GPIO_PIN_1 && event.type == Debounce_Event_Press)
+				MCAL_GPIO_TogglePin(GPIOB, GPIO_PIN_1); /* Single Press */
+
+			if(event.pin == GPIO_PIN_13 && event.type != Debounce_Event_Release)
+				MCAL_GPIO_TogglePin(GPIOB, GPIO_PIN_13); /* Press, then Long Press */
 		}
-		myWait();
+
+		/* Sleep until the next SysTick */
+		__asm volatile ("wfi");
 	}
 }
-
@@ -0,0 +1,175 @@
+/*
+ * spi_slave_loopback.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ *
+ * On target check of the SPI slave engine: SPI2 (master, NSS by GPIO) runs two back-to-back NSS
+ * frames against SPI1 (slave engine) on the same board.
+ *
+ * Wiring:
+ * 		PB12 (GPIO NSS) --> PA4 (SPI1_NSS)
+ * 		PB13 (SPI2_SCK) --> PA5 (SPI1_SCK)
+ * 		PB15 (SPI2_MOSI) --> PA7 (SPI1_MOSI)
+ * 		PA6 (SPI1_MISO) --> PB14 (SPI2_MISO)
+ *
+ * Call SPI_Slave_Loopback_Example() from main() instead of the button demo (it uses PB13).
+ */
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include "STM32F103x8_SPI_Driver.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/***************** Generic Variables *******************/
+/*******************************************************/
+#define LOOPBACK_FRAME_LENGTH				4
+#define LOOPBACK_TIMEOUT_MS					10
+
+static uint8_t Loopback_RxRing[32];
+
+static const uint8_t Loopback_Response1[LOOPBACK_FRAME_LENGTH] = {0xA1, 0xA2, 0xA3, 0xA4};
+static const uint8_t Loopback_Response2[LOOPBACK_FRAME_LENGTH] = {0xB1, 0xB2, 0xB3, 0xB4};
+
+static volatile uint8_t Loopback_Deselects = 0;
+static volatile uint16_t Loopback_Frames = 0;
+
+/*******************************************************/
+
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
+/**===============================================================================================
+ * @FName			- Loopback_Event_CallBack
+ * @Brief 			- Counts the transactions seen by the slave
+ * @Parameter [in] 	- event: @ref SPI_Slave_Event_define
+ * @Parameter [in] 	- frames: frames received in the transaction
+ * @Return Value	- NONE
+ * Note				- Called from the NSS EXTI interrupt (EXTI4)
+ */
+static void Loopback_Event_CallBack(uint8_t event, uint16_t frames){
+	if(event == SPI_Slave_Event_Deselect){
+		Loopback_Deselects++;
+		Loopback_Frames += frames;
+	}
+}
+
+/**===============================================================================================
+ * @FName			- Loopback_Compare
+ * @Brief 			- Byte compare of two frames
+ * @Parameter [in] 	- pA, pB: frames to compare
+ * @Return Value	- MCAL_OK if equal, else MCAL_ERROR
+ * Note				- NONE
+ */
+static MCAL_Status_t Loopback_Compare(const uint8_t *pA, const uint8_t *pB){
+	uint8_t i;
+
+	for(i = 0; i < LOOPBACK_FRAME_LENGTH; i++){
+		if(pA[i] != pB[i])
+			return MCAL_ERROR;
+	}
+
+	return MCAL_OK;
+}
+
+/*******************************************************/
+
+/**================================================================
+ * @Fn				- SPI_Slave_Loopback_Example
+ * @brief 			- Runs two NSS frames back to back from SPI2 to the SPI1 slave engine
+ * @retval 			- MCAL_OK if both responses and both received frames are right,
+ * 					  MCAL_TIMEOUT if the slave misses a deselect event, else MCAL_ERROR
+ * Note				- The second response is given while the first frame runs, it must be armed by the
+ * 					  first NSS rising edge and the EXTI4 line must stay enabled for the second one
+ */
+MCAL_Status_t SPI_Slave_Loopback_Example(void){
+	const uint8_t tx1[LOOPBACK_FRAME_LENGTH] = {0x11, 0x12, 0x13, 0x14};
+	const uint8_t tx2[LOOPBACK_FRAME_LENGTH] = {0x21, 0x22, 0x23, 0x24};
+	uint8_t rx1[LOOPBACK_FRAME_LENGTH], rx2[LOOPBACK_FRAME_LENGTH];
+	uint8_t received[2 * LOOPBACK_FRAME_LENGTH];
+	SPI_Config_t SPI_Cfg = {0};
+	SPI_Slave_Config_t Slave_Cfg;
+	GPIO_PinConfig_t NSS_Cfg;
+	DWT_Timeout_t timer;
+	uint16_t count;
+
+	RCC_AFIO_CLK_EN();
+	RCC_GPIOA_CLK_EN();
+	RCC_GPIOB_CLK_EN();
+
+	/* SPI1: slave, NSS pin framed */
+	SPI_Cfg.deviceMode = SPI_Device_Mode_Slave;
+	SPI_Cfg.communicationMode = SPI_Direction_2Lines;
+	SPI_Cfg.frameFormat = SPI_Frame_Format_MSB_transmitted_first;
+	SPI_Cfg.dataSize = SPI_Data_Size_8bits;
+	SPI_Cfg.CLK_Polarity = SPI_CLK_Polarity_Idle_Low;
+	SPI_Cfg.CLK_Phase = SPI_CLK_Phase_first_clock_transition;
+	SPI_Cfg.NSS = SPI_NSS_HW_Slave;
+	SPI_Cfg.CLK_Frequency = SPI_CLK_Frequency_2;
+	SPI_Cfg.IRQ_Enable = SPI_IRQ_Enable_NONE;
+	SPI_Cfg.CRC_Enable = SPI_CRC_Disable;
+	MCAL_SPI_Init(SPI1, &SPI_Cfg);
+	MCAL_SPI_GPIO_SET_PINs(SPI1);
+
+	/* SPI2: master, software NSS, PB12 drives the slave NSS */
+	SPI_Cfg.deviceMode = SPI_Device_Mode_Master;
+	SPI_Cfg.NSS = SPI_NSS_SW_Set_SSI;
+	SPI_Cfg.CLK_Frequency = SPI_CLK_Frequency_32;
+	MCAL_SPI_Init(SPI2, &SPI_Cfg);
+	MCAL_SPI_GPIO_SET_PINs(SPI2);
+
+	MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
+	NSS_Cfg.pinNumber = GPIO_PIN_12;
+	NSS_Cfg.mode = GPIO_MODE_OUTPUT_PP;
+	NSS_Cfg.outputSpeed = GPIO_SPEED_10M;
+	MCAL_GPIO_Init(GPIOB, &NSS_Cfg);
+
+	Slave_Cfg.pRxRing = Loopback_RxRing;
+	Slave_Cfg.RxRing_Length = sizeof(Loopback_RxRing);
+	Slave_Cfg.pTxBuffer = Loopback_Response1;
+	Slave_Cfg.TxLength = LOOPBACK_FRAME_LENGTH;
+	Slave_Cfg.P_Event_CallBack = Loopback_Event_CallBack;
+
+	Loopback_Deselects = 0;
+	Loopback_Frames = 0;
+
+	if(MCAL_SPI_Slave_Start(SPI1, &Slave_Cfg) != MCAL_OK)
+		return MCAL_ERROR;
+
+	/* Frame 1, the next response is queued while NSS is low */
+	MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
+	MCAL_SPI_Slave_SetResponse(SPI1, Loopback_Response2, LOOPBACK_FRAME_LENGTH);
+	MCAL_SPI_Transfer(SPI2, tx1, rx1, LOOPBACK_FRAME_LENGTH);
+	MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
+
+	/* Frame 2, right after the rising edge (the EXTI4 re-arm preempts this thread) */
+	MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
+	MCAL_SPI_Transfer(SPI2, tx2, rx2, LOOPBACK_FRAME_LENGTH);
+	MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
+
+	MCAL_DWT_Timeout_Start(&timer, LOOPBACK_TIMEOUT_MS);
+	while(Loopback_Deselects < 2){
+		if(DWT_TIMEOUT_EXPIRED(timer)){
+			MCAL_SPI_Slave_Stop(SPI1);
+			return MCAL_TIMEOUT;
+		}
+	}
+
+	/* The ring is only readable while the engine runs */
+	count = MCAL_SPI_Slave_Read(SPI1, received, sizeof(received));
+	MCAL_SPI_Slave_Stop(SPI1);
+
+	if((Loopback_Frames != 2 * LOOPBACK_FRAME_LENGTH) || (count != sizeof(received)))
+		return MCAL_ERROR;
+
+	if((Loopback_Compare(rx1, Loopback_Response1) != MCAL_OK) ||
+	   (Loopback_Compare(rx2, Loopback_Response2) != MCAL_OK) ||
+	   (Loopback_Compare(&received[0], tx1) != MCAL_OK) ||
+	   (Loopback_Compare(&received[LOOPBACK_FRAME_LENGTH], tx2) != MCAL_OK))
+		return MCAL_ERROR;
+
+	return MCAL_OK;
+}
@@ -0,0 +1,136 @@
+/*
+ * usart_tx_benchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Mohamed Sherif
+ *
+ * On target measure of the CPU cycles needed to send 1 KiB with MCAL_USART_Write() (polling)
+ * and with MCAL_USART_SendBuffer_DMA().
+ *
+ * Both paths are timed with DWT_CYCCNT (HCLK cycles) up to the last byte loaded into DR:
+ * 		pollCycles	: the whole MCAL_USART_Write() call, the CPU is held for the full line time
+ * 		dmaCycles	: cycles taken away from the thread (setup call + DMA interrupt + callback),
+ * 					  the thread counts idle iterations while the transfer runs and the idle time
+ * 					  is removed using a calibration of the same loop
+ * 		lineCycles	: elapsed cycles of the DMA transfer (about the line time of 1 KiB)
+ *
+ * Call USART_Tx_Benchmark() from main() after MCAL_USART_Init() (8-bit payload, Tx enabled) and read
+ * the results in the debugger. The TX pin only needs to be left open or wired to a terminal.
+ */
+
+/*******************************************************/
+/********************* Includes ************************/
+/*******************************************************/
+#include "STM32F103x8_USART_Driver.h"
+#include "STM32F103x8_DWT_Driver.h"
+
+/*******************************************************/
+
+/*******************************************************/
+/***************** Generic Variables *******************/
+/*******************************************************/
+#define USART_BENCH_LENGTH					1024		/* 1 KiB, results are per KiB */
+#define USART_BENCH_CALIBRATION				10000		/* idle loop iterations timed for calibration */
+#define USART_BENCH_TIMEOUT_MS				1000		/* 1 KiB at 9600 bauds takes about 1.07 s, use 19200 or more */
+
+typedef struct{
+	uint32_t pollCycles;
+	uint32_t dmaCycles;
+	uint32_t lineCycles;
+} USART_Bench_Result_t;
+
+/* Sent from flash, so both paths read the same memory */
+static const uint8_t USART_Bench_Buffer[USART_BENCH_LENGTH] = "USART TX benchmark, 1 KiB block\r\n";
+
+static volatile uint8_t USART_Bench_Done;
+static volatile MCAL_Status_t USART_Bench_Status;
+
+/* Filled by USART_Tx_Benchmark(), watch it in the debugger */
+USART_Bench_Result_t USART_Bench_Result;
+
+/*******************************************************/
+
+/*******************************************************/
+/******************** Generic Functions ****************/
+/*******************************************************/
+/**===============================================================================================
+ * @FName			- USART_Bench_CallBack
+ * @Brief 			- End of the DMA transfer
+ * @Parameter [in] 	- status: MCAL_OK or MCAL_ERROR (DMA transfer error)
+ * @Return Value	- NONE
+ * Note				- Called from the DMA interrupt
+ */
+static void USART_Bench_CallBack(MCAL_Status_t status){
+	USART_Bench_Status = status;
+	USART_Bench_Done = 1;
+}
+
+/**===============================================================================================
+ * @FName			- USART_Bench_Idle
+ * @Brief 			- Counts loop iterations until the DMA callback runs, limit is reached or the wait expires
+ * @Parameter [in] 	- limit: maximum number of iterations
+ * @Parameter [in] 	- pTimeout: bound of the wait
+ * @Return Value	- number of iterations
+ * Note				- The same loop is used for the calibration and for the measure, so one iteration
+ * 					  costs the same number of cycles in both
+ */
+static uint32_t __attribute__((noinline)) USART_Bench_Idle(uint32_t limit, const DWT_Timeout_t *pTimeout){
+	uint32_t idle = 0;
+
+	while(!USART_Bench_Done && (idle != limit) && !DWT_TIMEOUT_EXPIRED(*pTimeout))
+		idle++;
+
+	return idle;
+}
+
+/*******************************************************/
+
+/**================================================================
+ * @Fn				- USART_Tx_Benchmark
+ * @brief 			- Times 1 KiB sent by polling and by DMA into USART_Bench_Result
+ * @param [in] 		- USARTx: initialized USART (8-bit payload, Tx enabled)
+ * @retval 			- MCAL_OK, MCAL_BUSY (DMA channel not free), MCAL_TIMEOUT or MCAL_ERROR (DMA error)
+ * Note				- Run it with no other interrupt traffic, any other ISR is counted as DMA path cost
+ */
+MCAL_Status_t USART_Tx_Benchmark(USART_TypeDef *USARTx){
+	DWT_Timeout_t timer;
+	uint32_t start, elapsed, calibration, idle;
+
+	MCAL_DWT_Init();
+	MCAL_DWT_Timeout_Start(&timer, USART_BENCH_TIMEOUT_MS);
+
+	/* Cost of USART_BENCH_CALIBRATION idle iterations */
+	USART_Bench_Done = 0;
+	start = DWT_CYCCNT;
+	USART_Bench_Idle(USART_BENCH_CALIBRATION, &timer);
+	calibration = DWT_CYCCNT - start;
+
+	/* Polling: the CPU writes every byte */
+	if(MCAL_USART_Wait_Tc(USARTx) != MCAL_OK)
+		return MCAL_TIMEOUT;
+	start = DWT_CYCCNT;
+	if(MCAL_USART_Write(USARTx, USART_Bench_Buffer, USART_BENCH_LENGTH, USART_BENCH_TIMEOUT_MS) != USART_BENCH_LENGTH)
+		return MCAL_TIMEOUT;
+	USART_Bench_Result.pollCycles = DWT_CYCCNT - start;
+
+	/* DMA: the thread idles while the transfer runs */
+	if(MCAL_USART_Wait_Tc(USARTx) != MCAL_OK)
+		return MCAL_TIMEOUT;
+	USART_Bench_Done = 0;
+	start = DWT_CYCCNT;
+	if(MCAL_USART_SendBuffer_DMA(USARTx, USART_Bench_Buffer, USART_BENCH_LENGTH, USART_Bench_CallBack) != MCAL_OK)
+		return MCAL_BUSY;
+	DWT_TIMEOUT_RESTART(timer);
+	idle = USART_Bench_Idle(0xFFFFFFFFUL, &timer);
+	elapsed = DWT_CYCCNT - start;
+
+	if(!USART_Bench_Done)
+		return MCAL_TIMEOUT;
+	if(USART_Bench_Status != MCAL_OK)
+		return MCAL_ERROR;
+
+	USART_Bench_Result.lineCycles = elapsed;
+	USART_Bench_Result.dmaCycles = elapsed - (uint32_t)(((uint64_t)idle * calibration) / USART_BENCH_CALIBRATION);
+
+	return MCAL_USART_Wait_Tc(USARTx);
+}